@@ -1,7 +1,15 @@
+/* open, mmap and mkstemp for the twiddle table files */
+#define _POSIX_C_SOURCE 200809L
+
 #include "s21_math.h"
 
+#include <fcntl.h>
 #include <float.h>
+#include <stdatomic.h>
 #include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 s21_bool s21_ldeq(long double a, long double b) {
     return (a < b + s21_EPS_8 && a > b - s21_EPS_8);
@@ -64,33 +72,6 @@ long double s21_atan_cust(double x) {
                : s21_atan_custom_pos_neg(magic, res, modulo_x, &special, x);
 }
 
-/**
- * @brief Computes the factorial of a non-negative integer n.
- * @param n Non-negative integer input.
- * @return Factorial of n.
- */
-long double s21_fact(long double n) {
-    long double res = 1;
-    for (int exp = 1; exp <= n; ++exp) {
-        res *= exp;
-    }
-    return res;
-}
-
-/**
- * @brief Computes the rising factorial of x, denoted as x(x+1)(x+2)...(x+n-1).
- * @param x Input value.
- * @param n Number of terms in the rising factorial.
- * @return Rising factorial of x.
- */
-long double s21_risingFact(long double x, int n) {
-    long double res = 1;
-    for (int k = 0; k <= n - 1; ++k) {
-        res *= x + k;
-    }
-    return res;
-}
-
 int s21_abs(int x) {
     long long _x = x < 0 ? (long long)-x : (long long)x;
     if (_x > __INT32_MAX__) {
@@ -99,66 +80,63 @@ int s21_abs(int x) {
     return (int)_x;
 }
 
-long double s21_acos(double x) {
-    const long double zero_acos = 1.5707963267948966;
-    long double res = 0.0;
-
-    if (s21_ldeq(x, 0.0)) return zero_acos;
-
-    s21_bool mod = (s21_fabs(x) > 1.0);
-    s21_bool sign = (x > 0.0);
-
-    /* These inputs DO NOT raise errno (unlike |x| > 1.0) */
-    s21_bool invalid = ((is_nan(x) || !is_fin(x)) && !s21_ldeq(x, 0.0));
-
-    if (!sign && !invalid && !s21_ldeq(x, 0.0)) {
-        return (s21_M_PI - s21_acos(x * -1.0));
-    }
+/**
+ * @brief Returns |v| with the sign of s, using integer ops that vectorize.
+ */
+static inline double s21_copysign(double v, double s) {
+    uint64_t bv, bs;
+    memcpy(&bv, &v, sizeof(bv));
+    memcpy(&bs, &s, sizeof(bs));
+    bv = (bv & 0x7fffffffffffffffULL) | (bs & 0x8000000000000000ULL);
+    memcpy(&v, &bv, sizeof(v));
+    return v;
+}
 
-    if (!invalid) {
-        mod = (s21_fabs(x) > 1.0);
-        if (mod) {
-            errno = EDOM;
-        } else if (s21_ldeq(x, 1.0)) {
-            res = 0.0;
-        } else if (s21_ldeq(x, -1.0)) {
-            res = s21_M_PI;
-        } else if (s21_fabs(x) > 0.0) {
-            if (s21_ldeq(x, 0.0))
-                res = zero_acos;
-            else
-                res += s21_atan_cust(s21_sqrt(1 - x * x) / x);
-        }
-    }
+/* atan(c) as hi + lo for the reduction points c = 0, 0.5, 1, 1.5, inf */
+static const double s21_atan_hi[5] = {
+    0.0, 4.63647609000806093515e-01, 7.85398163397448278999e-01,
+    9.82793723247329054082e-01, 1.57079632679489655800e+00};
+static const double s21_atan_lo[5] = {
+    0.0, 2.26987774529616870924e-17, 3.06161699786838301793e-17,
+    1.39033110312309984516e-17, 6.12323399573676603587e-17};
+
+/* the even and odd halves of the atan(t) polynomial, both in t^4 */
+static const double s21_atan_even[6] = {
+    3.33333333333329318027e-01, 1.42857142725034663711e-01,
+    9.09088713343650656196e-02, 6.66107313738753120669e-02,
+    4.97687799461593236017e-02, 1.62858201153657823623e-02};
+static const double s21_atan_odd[5] = {
+    -1.99999999998764832476e-01, -1.11111104054623557880e-01,
+    -7.69187620504482999495e-02, -5.83357013379057348645e-02,
+    -3.65315727442169155270e-02};
 
-    return (mod || invalid) ? s21_NAN : res;
+/**
+ * @brief Shared arctangent core.
+ *
+ * |x| is reduced to |t| <= 7/16 with atan(a) = atan(c) + atan((a-c)/(1+ac))
+ * for the nearest c, or with atan(a) = pi/2 - atan(1/a) past 39/16, and
+ * atan(t) is an odd degree 23 polynomial. The reduction is written as
+ * selects so the batch forms vectorize.
+ */
+static inline double s21_atan_kernel(double x) {
+    double a = __builtin_fabs(x);
+    int id = (a >= 0.4375) + (a >= 0.6875) + (a >= 1.1875) + (a >= 2.4375);
+    double c = id == 1 ? 0.5 : id == 2 ? 1.0 : 1.5;
+    double num = id == 0 ? a : id == 4 ? -1.0 : a - c;
+    double den = id == 0 ? 1.0 : id == 4 ? a : 1.0 + a * c;
+    double t = num / den;
+
+    double z = t * t, w = z * z;
+    double s1 = z * s21_HORNER6(w, s21_atan_even);
+    double s2 = w * s21_HORNER5(w, s21_atan_odd);
+    double res = s21_atan_hi[id] - ((t * (s1 + s2) - s21_atan_lo[id]) - t);
+    return s21_copysign(res, x);
 }
 
-long double s21_asin(double x) {
-    long double res = s21_NAN;
-    if (x > 1 || x < -1) return res;
-    if (x == 1 || x == -1) res = s21_PI / (2 * x);
-    if (x > -1 && x < 1) res = s21_PI / 2 - s21_acos(x);
-    return res;
-}
+long double s21_atan(double x) { return s21_atan_kernel(x); }
 
-long double s21_atan(double x) {
-    long double res = 0;
-    if (x == s21_INF) return s21_PI / 2;
-    if (x == -s21_INF) return -s21_PI / 2;
-    if (x != x) return x;
-    if (x == 1) return 0.785398163;
-    if (x == -1) return -0.785398163;
-    int is_in_range = (x > -1 && x < 1);
-    res = is_in_range ? x : 1.0 / x;
-    for (int i = 1; i < 7000; i++) {
-        double a = s21_pow(-1, i);
-        double b = s21_pow(x, (1 + 2 * i) * (is_in_range ? 1 : -1));
-        double c = 1 + 2 * i;
-        res += a * b / c;
-    }
-    if (!is_in_range) res = (s21_PI * s21_fabs(x) / (2 * x)) - res;
-    return res;
+void s21_atan_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_atan_kernel(in[i]);
 }
 
 long double s21_ceil(double x) {
@@ -196,20 +174,246 @@ long double s21_cos(double x) {
     return sum * sign;
 }
 
-long double s21_exp(double x) {
-    if (x == s21_NAN) return s21_NAN;
-    if (x == -s21_INF || x < -14) return 0;
-    if (x == s21_INF) return s21_INF;
+/* 2^(j/64), j = 0..63 */
+static const double s21_exp2_tab[64] = {
+    0x1.0000000000000p+0, 0x1.02c9a3e778061p+0, 0x1.059b0d3158574p+0,
+    0x1.0874518759bc8p+0, 0x1.0b5586cf9890fp+0, 0x1.0e3ec32d3d1a2p+0,
+    0x1.11301d0125b51p+0, 0x1.1429aaea92de0p+0, 0x1.172b83c7d517bp+0,
+    0x1.1a35beb6fcb75p+0, 0x1.1d4873168b9aap+0, 0x1.2063b88628cd6p+0,
+    0x1.2387a6e756238p+0, 0x1.26b4565e27cddp+0, 0x1.29e9df51fdee1p+0,
+    0x1.2d285a6e4030bp+0, 0x1.306fe0a31b715p+0, 0x1.33c08b26416ffp+0,
+    0x1.371a7373aa9cbp+0, 0x1.3a7db34e59ff7p+0, 0x1.3dea64c123422p+0,
+    0x1.4160a21f72e2ap+0, 0x1.44e086061892dp+0, 0x1.486a2b5c13cd0p+0,
+    0x1.4bfdad5362a27p+0, 0x1.4f9b2769d2ca7p+0, 0x1.5342b569d4f82p+0,
+    0x1.56f4736b527dap+0, 0x1.5ab07dd485429p+0, 0x1.5e76f15ad2148p+0,
+    0x1.6247eb03a5585p+0, 0x1.6623882552225p+0, 0x1.6a09e667f3bcdp+0,
+    0x1.6dfb23c651a2fp+0, 0x1.71f75e8ec5f74p+0, 0x1.75feb564267c9p+0,
+    0x1.7a11473eb0187p+0, 0x1.7e2f336cf4e62p+0, 0x1.82589994cce13p+0,
+    0x1.868d99b4492edp+0, 0x1.8ace5422aa0dbp+0, 0x1.8f1ae99157736p+0,
+    0x1.93737b0cdc5e5p+0, 0x1.97d829fde4e50p+0, 0x1.9c49182a3f090p+0,
+    0x1.a0c667b5de565p+0, 0x1.a5503b23e255dp+0, 0x1.a9e6b5579fdbfp+0,
+    0x1.ae89f995ad3adp+0, 0x1.b33a2b84f15fbp+0, 0x1.b7f76f2fb5e47p+0,
+    0x1.bcc1e904bc1d2p+0, 0x1.c199bdd85529cp+0, 0x1.c67f12e57d14bp+0,
+    0x1.cb720dcef9069p+0, 0x1.d072d4a07897cp+0, 0x1.d5818dcfba487p+0,
+    0x1.da9e603db3285p+0, 0x1.dfc97337b9b5fp+0, 0x1.e502ee78b3ff6p+0,
+    0x1.ea4afa2a490dap+0, 0x1.efa1bee615a27p+0, 0x1.f50765b6e4540p+0,
+    0x1.fa7c1819e90d8p+0,
+};
+
+#define s21_EXP_SHIFT 0x1.8p52
+#define s21_EXP_INV_LN2_64 0x1.71547652b82fep+6
+#define s21_EXP_LN2_64_HI 0x1.62e42fee00000p-7
+#define s21_EXP_LN2_64_LO 0x1.a39ef35793c76p-39
+#define s21_EXP_LOG2_10_64 0x1.a934f0979a371p+7
+#define s21_EXP_LOG10_2_64_HI 0x1.3441350800000p-8
+#define s21_EXP_LOG10_2_64_LO 0x1.f79fef311f12bp-40
+#define s21_LN_10 0x1.26bb1bbb55516p+1
+#define s21_LN_2_D 0x1.62e42fefa39efp-1
 
-    long double arg = (long double)x;
-    long double sum = 1.0;
-    long double tailor = 1.0;
+/**
+ * @brief Rounds z (|z| < 2^51) to the nearest integer without a branch or
+ * a conversion instruction, returning it both as double and as int64_t.
+ */
+static inline double s21_round_shift(double z, int64_t *kn) {
+    double t = z + s21_EXP_SHIFT;
+    int64_t bits, shift_bits;
+    double shift = s21_EXP_SHIFT;
+    memcpy(&bits, &t, sizeof(bits));
+    memcpy(&shift_bits, &shift, sizeof(shift_bits));
+    *kn = bits - shift_bits;
+    return t - s21_EXP_SHIFT;
+}
 
-    for (int p = 1; s21_fabs(tailor / sum) > 1e-100; p++) {
-        tailor = (tailor * arg) / p;
-        sum += tailor;
-    }
-    return sum;
+/**
+ * @brief Inverse of s21_round_shift: converts |k| < 2^51 to double with bit
+ * operations, which unlike a cast is not treated as possibly trapping and
+ * so does not stop the batch loops from being if-converted.
+ */
+static inline double s21_int_to_double(int64_t k) {
+    double shift = s21_EXP_SHIFT, res;
+    int64_t bits;
+    memcpy(&bits, &shift, sizeof(bits));
+    bits += k;
+    memcpy(&res, &bits, sizeof(res));
+    return res - s21_EXP_SHIFT;
+}
+
+/**
+ * @brief Returns 2^k for k in the normal exponent range.
+ */
+static inline double s21_pow2i(int64_t k) {
+    uint64_t bits = (uint64_t)(k + 1023) << 52;
+    double res;
+    memcpy(&res, &bits, sizeof(res));
+    return res;
+}
+
+/**
+ * @brief e^r - 1 for |r| <= ln2/128, where degree 5 reaches double precision.
+ */
+static inline double s21_exp_poly(double r) {
+    static const double coef[5] = {1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24,
+                                   1.0 / 120};
+    return r * s21_HORNER5(r, coef);
+}
+
+/**
+ * @brief Shared exponential core: 2^(kn/64) * e^r for |r| <= ln2/128.
+ *
+ * The scale is applied in two halves so results that overflow or go
+ * subnormal are rounded once, by the last multiplication.
+ */
+static inline double s21_exp_tail(double r, int64_t kn) {
+    double t = s21_exp2_tab[kn & 63];
+    int64_t k = kn >> 6;
+    int64_t k1 = k >> 1;
+    return (t + t * s21_exp_poly(r)) * s21_pow2i(k1) * s21_pow2i(k - k1);
+}
+
+/*
+ * The kernels below reduce the raw argument and only then replace
+ * out-of-range lanes with 0 or inf. Clamping the argument first would let
+ * the compiler fold the clamped lanes into constants and split the loop
+ * into branches, which keeps the batch forms from being vectorized.
+ */
+
+static inline double s21_exp_kernel(double x) {
+    int64_t kn;
+    double kd = s21_round_shift(x * s21_EXP_INV_LN2_64, &kn);
+    double r = x - kd * s21_EXP_LN2_64_HI - kd * s21_EXP_LN2_64_LO;
+    double res = s21_exp_tail(r, kn);
+    res = x > 710.0 ? s21_INF : res;
+    return x < -746.0 ? 0.0 : res;
+}
+
+static inline double s21_exp2_kernel(double x) {
+    int64_t kn;
+    double kd = s21_round_shift(x * 64.0, &kn);
+    double res = s21_exp_tail((x - kd * (1.0 / 64)) * s21_LN_2_D, kn);
+    res = x > 1025.0 ? s21_INF : res;
+    return x < -1076.0 ? 0.0 : res;
+}
+
+static inline double s21_exp10_kernel(double x) {
+    int64_t kn;
+    double kd = s21_round_shift(x * s21_EXP_LOG2_10_64, &kn);
+    double r = x - kd * s21_EXP_LOG10_2_64_HI - kd * s21_EXP_LOG10_2_64_LO;
+    double res = s21_exp_tail(r * s21_LN_10, kn);
+    res = x > 310.0 ? s21_INF : res;
+    return x < -325.0 ? 0.0 : res;
+}
+
+/**
+ * @brief e^x - 1, and e^x / 2 through *half, from one argument reduction.
+ *
+ * The halved exponential is what the hyperbolic functions need, and
+ * scaling it inside the tail keeps it finite up to the real overflow
+ * threshold of sinh and cosh.
+ */
+static inline double s21_expm1_pair(double x, double *half) {
+    /* x * (1 + x/2 * (1 + x/3 * (...))) has no leading 1 to cancel */
+    double s = 1.0;
+    for (int k = 15; k >= 2; k--) s = 1.0 + s * x * (1.0 / k);
+    double small = x * s;
+
+    int64_t kn;
+    double kd = s21_round_shift(x * s21_EXP_INV_LN2_64, &kn);
+    double r = x - kd * s21_EXP_LN2_64_HI - kd * s21_EXP_LN2_64_LO;
+    double t = s21_exp2_tab[kn & 63];
+    double p = s21_exp_poly(r);
+    int64_t k = kn >> 6;
+    double scale1 = s21_pow2i(k >> 1), scale2 = s21_pow2i(k - (k >> 1));
+    /* for moderate x, s - 1 is exact and carries the cancellation */
+    double sc = t * scale1 * scale2;
+    double mid = (sc - 1.0) + sc * p;
+    double big = (t + t * p) * scale1 * scale2 - 1.0;
+    *half = x > 711.0 ? s21_INF : (t + t * p) * scale1 * (scale2 * 0.5);
+
+    double res = x > 2.0 ? big : mid;
+    res = (x > -0.34657359027997264 && x < 0.34657359027997264) ? small : res;
+    res = x > 710.0 ? s21_INF : res;
+    return x < -746.0 ? -1.0 : res;
+}
+
+static inline double s21_expm1_kernel(double x) {
+    double half;
+    return s21_expm1_pair(x, &half);
+}
+
+long double s21_exp(double x) { return s21_exp_kernel(x); }
+
+long double s21_exp2(double x) { return s21_exp2_kernel(x); }
+
+long double s21_exp10(double x) { return s21_exp10_kernel(x); }
+
+long double s21_expm1(double x) { return s21_expm1_kernel(x); }
+
+void s21_exp_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_exp_kernel(in[i]);
+}
+
+void s21_exp2_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_exp2_kernel(in[i]);
+}
+
+void s21_exp10_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_exp10_kernel(in[i]);
+}
+
+void s21_expm1_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_expm1_kernel(in[i]);
+}
+
+/*
+ * Hyperbolic functions work on |x| and restore the sign at the end. Below
+ * the switch-over points they are formed from e^|x| - 1, which keeps the
+ * small results free of cancellation; above it from e^|x| / 2, which only
+ * overflows where the result itself does.
+ */
+
+static inline double s21_sinh_kernel(double x) {
+    double a = __builtin_fabs(x), h;
+    s21_expm1_pair(a, &h);
+    /* the Taylor series needs ten terms below 1 and has no cancellation */
+    double z = a * a, p = 1.0;
+    for (int k = 19; k >= 3; k -= 2) p = 1.0 + p * z * (1.0 / (k * (k - 1)));
+    double res = a < 1.0 ? a * p : h - 0.25 / h;
+    return x != x ? x : s21_copysign(res, x);
+}
+
+static inline double s21_cosh_kernel(double x) {
+    double a = __builtin_fabs(x), h;
+    double e = s21_expm1_pair(a, &h);
+    double res = a < 0.5 ? 1.0 + (e * e) / (2.0 * (e + 1.0)) : h + 0.25 / h;
+    return x != x ? x : res;
+}
+
+static inline double s21_tanh_kernel(double x) {
+    double a = __builtin_fabs(x);
+    /* e^-2a - 1 stays in (-1, 0] below 1, which divides more accurately */
+    double e = s21_expm1_kernel(a < 1.0 ? -2.0 * a : 2.0 * a);
+    double res = a < 1.0 ? -e / (e + 2.0) : 1.0 - 2.0 / (e + 2.0);
+    /* tanh(|x|) rounds to 1 from here on, and e is already inf */
+    res = a > 22.0 ? 1.0 : res;
+    return s21_copysign(res, x);
+}
+
+long double s21_sinh(double x) { return s21_sinh_kernel(x); }
+
+long double s21_cosh(double x) { return s21_cosh_kernel(x); }
+
+long double s21_tanh(double x) { return s21_tanh_kernel(x); }
+
+void s21_sinh_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_sinh_kernel(in[i]);
+}
+
+void s21_cosh_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_cosh_kernel(in[i]);
+}
+
+void s21_tanh_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_tanh_kernel(in[i]);
 }
 
 long double s21_fabs(double x) {
@@ -241,19 +445,363 @@ long double s21_fmod(double x, double y) {
     return lx - div * ly;
 }
 
-long double s21_log(double x) {
-    if (x == s21_INF) return x;
-    if (x == 0) return -s21_INF;
-    if (x < 0) return s21_NAN;
-    long double result = 0, compare = 0;
-    int e_repeat = 0;
-    for (; x >= s21_EXP; e_repeat++) x /= s21_EXP;
-    for (int i = 0; i < 100; i++) {
-        compare = result;
-        result = compare + 2 * (x - s21_exp(compare)) / (x + s21_exp(compare));
+/* log(j/128) as hi + lo, j = 90..182 */
+static const double s21_log_tab[93][2] = {
+    {-0x1.68ac83e9c6a14p-2, -0x1.a64eadd740178p-58},
+    {-0x1.5d5bddf595f30p-2, 0x1.6541148cbb8a2p-56},
+    {-0x1.522ae0738a3d8p-2, 0x1.8f7e9b38a6979p-57},
+    {-0x1.4718dc271c41bp-2, -0x1.8fb4c14c56eefp-60},
+    {-0x1.3c25277333184p-2, 0x1.2ad27e50a8ec6p-56},
+    {-0x1.314f1e1d35ce4p-2, 0x1.3d69909e5c3dcp-56},
+    {-0x1.269621134db92p-2, -0x1.e0efadd9db02bp-56},
+    {-0x1.1bf99635a6b95p-2, 0x1.12aeb84249223p-57},
+    {-0x1.1178e8227e47cp-2, 0x1.0e63a5f01c691p-57},
+    {-0x1.07138604d5862p-2, -0x1.cdb16ed4e9138p-56},
+    {-0x1.f991c6cb3b379p-3, -0x1.f665066f980a2p-57},
+    {-0x1.e530effe71012p-3, -0x1.2276041f43042p-59},
+    {-0x1.d1037f2655e7bp-3, -0x1.60629242471a2p-57},
+    {-0x1.bd087383bd8adp-3, -0x1.dd355f6a516d7p-60},
+    {-0x1.a93ed3c8ad9e3p-3, -0x1.bcafa9de97203p-57},
+    {-0x1.95a5adcf7017fp-3, -0x1.142c507fb7a3dp-58},
+    {-0x1.823c16551a3c2p-3, 0x1.1232ce70be781p-57},
+    {-0x1.6f0128b756abcp-3, 0x1.8de59c21e166cp-57},
+    {-0x1.5bf406b543db2p-3, 0x1.1f5b44c0df7e7p-61},
+    {-0x1.4913d8333b561p-3, 0x1.0d5604930f135p-58},
+    {-0x1.365fcb0159016p-3, -0x1.7d411a5b944adp-58},
+    {-0x1.23d712a49c202p-3, 0x1.6e38161051d69p-57},
+    {-0x1.1178e8227e47cp-3, 0x1.0e63a5f01c691p-58},
+    {-0x1.fe89139dbd566p-4, 0x1.ac9f4215f9393p-58},
+    {-0x1.da727638446a2p-4, -0x1.401fa71733019p-58},
+    {-0x1.b6ac88dad5b1cp-4, 0x1.0057eed1ca59fp-59},
+    {-0x1.9335e5d594989p-4, 0x1.478a85704ccb7p-58},
+    {-0x1.700d30aeac0e1p-4, 0x1.72566212cdd05p-61},
+    {-0x1.4d3115d207eacp-4, -0x1.769f42c7842ccp-58},
+    {-0x1.2aa04a44717a5p-4, 0x1.d15d38d2fa3f7p-58},
+    {-0x1.08598b59e3a07p-4, 0x1.dd7009902bf32p-58},
+    {-0x1.ccb73cdddb2ccp-5, 0x1.e48fb0500efd4p-59},
+    {-0x1.894aa149fb343p-5, -0x1.a8be97660a23dp-60},
+    {-0x1.466aed42de3eap-5, 0x1.cdd6f7f4a137ep-59},
+    {-0x1.0415d89e74444p-5, -0x1.c05cf1d753622p-59},
+    {-0x1.8492528c8cabfp-6, 0x1.d192d0619fa67p-60},
+    {-0x1.0205658935847p-6, -0x1.27c8e8416e71fp-60},
+    {-0x1.010157588de71p-7, -0x1.46662d417ced0p-62},
+    {0x0.0p+0, 0x0.0p+0},
+    {0x1.fe02a6b106789p-8, -0x1.e44b7e3711ebfp-67},
+    {0x1.fc0a8b0fc03e4p-7, -0x1.83092c59642a1p-62},
+    {0x1.7b91b07d5b11bp-6, -0x1.5b602ace3a510p-60},
+    {0x1.f829b0e783300p-6, 0x1.33e3f04f1ef23p-60},
+    {0x1.39e87b9febd60p-5, -0x1.5bfa937f551bbp-59},
+    {0x1.77458f632dcfcp-5, 0x1.18d3ca87b9296p-59},
+    {0x1.b42dd711971bfp-5, -0x1.eb9759c130499p-60},
+    {0x1.f0a30c01162a6p-5, 0x1.85f325c5bbacdp-59},
+    {0x1.16536eea37ae1p-4, -0x1.79da3e8c22cdap-60},
+    {0x1.341d7961bd1d1p-4, -0x1.b599f227becbbp-58},
+    {0x1.51b073f06183fp-4, 0x1.a49e39a1a8be4p-58},
+    {0x1.6f0d28ae56b4cp-4, -0x1.906d99184b992p-58},
+    {0x1.8c345d6319b21p-4, -0x1.4a697ab3424a9p-61},
+    {0x1.a926d3a4ad563p-4, 0x1.942f48aa70ea9p-58},
+    {0x1.c5e548f5bc743p-4, 0x1.5d617ef8161b1p-60},
+    {0x1.e27076e2af2e6p-4, -0x1.61578001e0162p-60},
+    {0x1.fec9131dbeabbp-4, -0x1.5746b9981b36cp-58},
+    {0x1.0d77e7cd08e59p-3, 0x1.9a5dc5e9030acp-57},
+    {0x1.1b72ad52f67a0p-3, 0x1.483023472cd74p-58},
+    {0x1.29552f81ff523p-3, 0x1.301771c407dbfp-57},
+    {0x1.371fc201e8f74p-3, 0x1.de6cb62af18a0p-58},
+    {0x1.44d2b6ccb7d1ep-3, 0x1.9f4f6543e1f88p-57},
+    {0x1.526e5e3a1b438p-3, -0x1.746ff8a470d3ap-57},
+    {0x1.5ff3070a793d4p-3, -0x1.bc60efafc6f6ep-58},
+    {0x1.6d60fe719d21dp-3, -0x1.caae268ecd179p-57},
+    {0x1.7ab890210d909p-3, 0x1.be36b2d6a0608p-59},
+    {0x1.87fa06520c911p-3, -0x1.bf7fdbfa08d9ap-57},
+    {0x1.9525a9cf456b4p-3, 0x1.d904c1d4e2e26p-57},
+    {0x1.a23bc1fe2b563p-3, 0x1.93711b07a998cp-59},
+    {0x1.af3c94e80bff3p-3, -0x1.398cff3641985p-58},
+    {0x1.bc286742d8cd6p-3, 0x1.4fce744870f55p-58},
+    {0x1.c8ff7c79a9a22p-3, -0x1.4f689f8434012p-57},
+    {0x1.d5c216b4fbb91p-3, 0x1.6e443597e4d40p-57},
+    {0x1.e27076e2af2e6p-3, -0x1.61578001e0162p-59},
+    {0x1.ef0adcbdc5936p-3, 0x1.48637950dc20dp-57},
+    {0x1.fb9186d5e3e2bp-3, -0x1.caaae64f21acbp-57},
+    {0x1.0402594b4d041p-2, -0x1.28ec217a5022dp-57},
+    {0x1.0a324e27390e3p-2, 0x1.7dcfde8061c03p-56},
+    {0x1.1058bf9ae4ad5p-2, 0x1.89fa0ab4cb31dp-58},
+    {0x1.1675cababa60ep-2, 0x1.ce63eab883717p-61},
+    {0x1.1c898c16999fbp-2, -0x1.0e5c62aff1c44p-60},
+    {0x1.22941fbcf7966p-2, -0x1.76f5eb09628afp-56},
+    {0x1.2895a13de86a3p-2, 0x1.7ad24c13f040ep-56},
+    {0x1.2e8e2bae11d31p-2, -0x1.8f4cdb95ebdf9p-56},
+    {0x1.347dd9a987d55p-2, -0x1.4dd4c580919f8p-57},
+    {0x1.3a64c556945eap-2, -0x1.c68651945f97cp-57},
+    {0x1.404308686a7e4p-2, -0x1.0bcfb6082ce6dp-56},
+    {0x1.4618bc21c5ec2p-2, 0x1.f42decdeccf1dp-56},
+    {0x1.4be5f957778a1p-2, -0x1.259b35b04813dp-57},
+    {0x1.51aad872df82dp-2, 0x1.3927ac19f55e3p-59},
+    {0x1.5767717455a6cp-2, 0x1.526adb283660cp-56},
+    {0x1.5d1bdbf5809cap-2, 0x1.4236383dc7fe1p-56},
+    {0x1.62c82f2b9c795p-2, 0x1.7b7af915300e5p-57},
+    {0x1.686c81e9b14afp-2, -0x1.ddea0f7f58e3dp-57},
+};
+
+#define s21_LOG_OFF 0x3fe6a09e667f3bcdULL /* bits of sqrt(0.5) */
+#define s21_LN_2_HI 0x1.62e42fefa3800p-1
+#define s21_LN_2_LO 0x1.ef35793c76730p-45
+#define s21_INV_LN_2 0x1.71547652b82fep+0
+#define s21_INV_LN_10 0x1.bcb7b1526e50ep-2
+
+/**
+ * @brief a * b - p exactly, where p is a * b rounded: one FMA, or Dekker's
+ * split product on targets without one.
+ */
+static inline double s21_mul_err(double a, double b, double p) {
+#if defined(__FMA__) || defined(__aarch64__)
+    return __builtin_fma(a, b, -p);
+#else
+    const double split = 0x1.0p27 + 1.0;
+    double ta = split * a, ah = ta - (ta - a), al = a - ah;
+    double tb = split * b, bh = tb - (tb - b), bl = b - bh;
+    return ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+}
+
+/**
+ * @brief Shared logarithm core for finite positive x = 2^e * z.
+ *
+ * z is in [sqrt(0.5), sqrt(2)) and is written as c * (1 + r) for the
+ * nearest c = j/128, so log(z) = log(c) + log1p(r) with |r| <= 1/256 and a
+ * degree 8 series. Returns log(z) as hi + lo and e as a double, leaving
+ * the callers to scale by their own base. With exact set, lo also carries
+ * the rounding error of r, for callers that scale the log up.
+ */
+static inline double s21_log_parts_acc(double x, double *lo, double *e,
+                                       s21_bool exact) {
+    double xs = x < DBL_MIN ? x * 0x1.0p54 : x;
+    int64_t eadj = x < DBL_MIN ? -54 : 0;
+    uint64_t ix, iz;
+    memcpy(&ix, &xs, sizeof(ix));
+    uint64_t tmp = ix - s21_LOG_OFF;
+    *e = s21_int_to_double(((int64_t)tmp >> 52) + eadj);
+    iz = ix - (tmp & 0xfffULL << 52);
+    double z;
+    memcpy(&z, &iz, sizeof(z));
+
+    int64_t j;
+    double c = s21_round_shift(z * 128.0, &j) * (1.0 / 128);
+    double r = (z - c) / c;
+    /* z - c is exact, so what r lost to rounding is one product away */
+    double q = r * c;
+    double rlo = exact ? (((z - c) - q) - s21_mul_err(r, c, q)) / c : 0.0;
+    double p =
+        r * r *
+        (-0.5 +
+         r * (1.0 / 3 +
+              r * (-0.25 + r * (0.2 + r * (-1.0 / 6 +
+                                           r * (1.0 / 7 - r * 0.125))))));
+    double logc = s21_log_tab[j - 90][0];
+    double hi = logc + r;
+    *lo = ((logc - hi) + r) + (s21_log_tab[j - 90][1] + (p + rlo));
+    return hi;
+}
+
+static inline double s21_log_parts(double x, double *lo, double *e) {
+    return s21_log_parts_acc(x, lo, e, 0);
+}
+
+/**
+ * @brief log(x) from the parts, with e*ln2 added in two pieces.
+ */
+static inline double s21_log_join(double hi, double lo, double e) {
+    double t = e * s21_LN_2_HI;
+    double res = t + hi;
+    return res + (((t - res) + hi) + (lo + e * s21_LN_2_LO));
+}
+
+/**
+ * @brief Patches the result for the inputs s21_log_parts does not cover:
+ * 0, negative, inf and NaN.
+ */
+static inline double s21_log_special(double x, double res) {
+    res = x == s21_INF ? x : res;
+    res = x == 0 ? -s21_INF : res;
+    return !(x >= 0) ? s21_NAN : res;
+}
+
+static inline double s21_log_kernel(double x) {
+    double lo, e, hi = s21_log_parts(x, &lo, &e);
+    return s21_log_special(x, s21_log_join(hi, lo, e));
+}
+
+static inline double s21_log2_kernel(double x) {
+    double lo, e, hi = s21_log_parts(x, &lo, &e);
+    return s21_log_special(x, e + (hi * s21_INV_LN_2 + lo * s21_INV_LN_2));
+}
+
+static inline double s21_log10_kernel(double x) {
+    double lo, e, hi = s21_log_parts(x, &lo, &e);
+    double res = s21_log_join(hi, lo, e);
+    return s21_log_special(x, res * s21_INV_LN_10);
+}
+
+static inline double s21_log1p_kernel(double x) {
+    /* log(1 + x) = log(u) + (x - (u - 1)) / u recovers the bits of x lost
+       when rounding u = 1 + x */
+    double u = 1.0 + x;
+    double lo, e, hi = s21_log_parts(u, &lo, &e);
+    double res = s21_log_join(hi, lo + (x - (u - 1.0)) / u, e);
+    res = (x > -0x1.0p-54 && x < 0x1.0p-54) ? x : res;
+    return s21_log_special(u, res);
+}
+
+long double s21_log(double x) { return s21_log_kernel(x); }
+
+long double s21_log2(double x) { return s21_log2_kernel(x); }
+
+long double s21_log10(double x) { return s21_log10_kernel(x); }
+
+long double s21_log1p(double x) { return s21_log1p_kernel(x); }
+
+void s21_log_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_log_kernel(in[i]);
+}
+
+void s21_log2_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_log2_kernel(in[i]);
+}
+
+void s21_log10_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_log10_kernel(in[i]);
+}
+
+void s21_log1p_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_log1p_kernel(in[i]);
+}
+
+/* batch kernels that need to look ahead work in blocks of this many */
+#define s21_BLOCK 64
+/* independent accumulators in reductions, enough to fill a vector */
+#define s21_LANES 8
+
+static inline double s21_sigmoid_kernel(double x) {
+    /* e^-|x| cannot overflow, so neither branch of the logistic can */
+    double e = s21_exp_kernel(-__builtin_fabs(x));
+    double r = 1.0 / (1.0 + e);
+    return x < 0 ? e * r : r;
+}
+
+void s21_sigmoid_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_sigmoid_kernel(in[i]);
+}
+
+/**
+ * @brief Maps a double to an integer with the same ordering, an
+ * involution. Integer maxima vectorize, floating-point ones do not
+ * unless the compiler may ignore NaNs and signed zeros.
+ */
+static inline int64_t s21_order_key(int64_t bits) {
+    return bits ^ (int64_t)((uint64_t)(bits >> 63) >> 1);
+}
+
+/**
+ * @brief Largest element of in; -inf when n is 0. A NaN with the sign bit
+ * clear counts as larger than inf, one with it set as smaller than -inf.
+ */
+static double s21_max_block(const double *in, size_t n) {
+    double res = -s21_INF;
+    int64_t m;
+    memcpy(&m, &res, sizeof(m));
+    m = s21_order_key(m);
+    for (size_t i = 0; i < n; i++) {
+        int64_t k;
+        memcpy(&k, &in[i], sizeof(k));
+        k = s21_order_key(k);
+        m = k > m ? k : m;
+    }
+    m = s21_order_key(m);
+    memcpy(&res, &m, sizeof(res));
+    return res;
+}
+
+/**
+ * @brief Sum of e^(in[i] - shift), kept in s21_LANES partial sums so the
+ * loop vectorizes without asking the compiler to reassociate additions.
+ */
+static double s21_expsum_lanes(const double *in, size_t n, double shift) {
+    double acc[s21_LANES] = {0};
+    size_t i = 0;
+    for (; i + s21_LANES <= n; i += s21_LANES) {
+        for (int k = 0; k < s21_LANES; k++) {
+            acc[k] += s21_exp_kernel(in[i + k] - shift);
+        }
+    }
+    for (; i < n; i++) acc[0] += s21_exp_kernel(in[i] - shift);
+    double res = 0.0;
+    for (int k = 0; k < s21_LANES; k++) res += acc[k];
+    return res;
+}
+
+/**
+ * @brief One streaming pass that finds a shift and the sum of
+ * e^(in[i] - shift), where shift is the maximum of in when it is finite.
+ *
+ * The running maximum is updated once per block, so each element costs a
+ * single exponential and the partial sum is rescaled once per block.
+ * An infinite maximum is not used as a shift, since subtracting it would
+ * turn the infinite elements into NaN.
+ */
+static double s21_expsum_online(const double *in, size_t n, double *shift) {
+    double m = -s21_INF, sh = 0.0, sum = 0.0;
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t len = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        double bm = s21_max_block(in + i, len);
+        if (bm > m) {
+            m = bm;
+            double new_sh = is_fin(m) ? m : 0.0;
+            if (sum != 0) sum *= s21_exp_kernel(sh - new_sh);
+            sh = new_sh;
+        }
+        sum += s21_expsum_lanes(in + i, len, sh);
+    }
+    *shift = sh;
+    return sum;
+}
+
+void s21_softmax_n(const double *in, double *out, size_t n) {
+    double shift, sum = s21_expsum_online(in, n, &shift);
+    for (size_t i = 0; i < n; i++) {
+        out[i] = s21_exp_kernel(in[i] - shift) / sum;
+    }
+}
+
+long double s21_logsumexp_n(const double *in, size_t n) {
+    double shift, sum = s21_expsum_online(in, n, &shift);
+    return shift + s21_log_kernel(sum);
+}
+
+void s21_poly_n(const double *c, int n_coef, const double *in, double *out,
+                size_t n) {
+    /* coefficients in the outer loop, so every multiply-add runs across
+       a whole block of points */
+    double acc[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t len = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        const double *x = in + i;
+        double top = n_coef > 0 ? c[n_coef - 1] : 0.0;
+        for (size_t j = 0; j < len; j++) acc[j] = top;
+        for (int k = n_coef - 2; k >= 0; k--) {
+            for (size_t j = 0; j < len; j++) {
+                acc[j] = s21_FMA(acc[j], x[j], c[k]);
+            }
+        }
+        for (size_t j = 0; j < len; j++) out[i + j] = acc[j];
     }
-    result += e_repeat;
-    return result;
+}
+
+static s21_bool s21_is_int(double x) {
+    return is_fin(x) &&
+           (s21_fabs(x) >= TWO52 || (double)(long long)x == x);
+}
+
+static s21_bool s21_is_odd(double x) {
+    return s21_is_int(x) && s21_fabs(x) < 2 * TWO52 && ((long long)x & 1);
 }
 
 long double s21_fast_pow(long double base, long long int exp) {
@@ -271,9 +819,16 @@ long double s21_fast_pow(long double base, long long int exp) {
     return res;
 }
 
+long double s21_powi(double x, int n) { return s21_fast_pow(x, n); }
+
 long double s21_pow(double base, double exp) {
     long double res;
 
+    if (s21_is_int(exp) && s21_fabs(exp) <= 64 && is_fin(base) &&
+        base != 0) {
+        return s21_fast_pow(base, (long long)exp);
+    }
+
     int b_n = is_nan(base);
     int b_f = is_fin(base);
     int e_n = is_nan(exp);
@@ -395,6 +950,333 @@ long double s21_pow(double base, double exp) {
     return res;
 }
 
+static const long double s21_ln2_l = 0.693147180559945309417232121458176568L;
+
+/**
+ * @brief Splits finite positive x into mantissa in [sqrt(0.5), sqrt(2)) and
+ * a power of two, the same way frexp does but from the bit pattern.
+ */
+static long double s21_split_exp(double x, int *e) {
+    uint64_t bits;
+    int shift = 0;
+    if (x < DBL_MIN) {
+        x *= 0x1.0p54;
+        shift = 54;
+    }
+    memcpy(&bits, &x, sizeof(bits));
+    *e = (int)((bits >> 52) & 0x7ff) - 1023 - shift;
+    bits = (bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+    double m;
+    memcpy(&m, &bits, sizeof(m));
+    if (m > 1.41421356237309504880) {
+        m *= 0.5;
+        ++*e;
+    }
+    return m;
+}
+
+/**
+ * @brief Natural logarithm of finite positive x in long double precision.
+ */
+static long double s21_log_hp(double x) {
+    int e;
+    long double m = s21_split_exp(x, &e);
+    long double s = (m - 1) / (m + 1), s2 = s * s;
+    long double term = s, sum = 0;
+    for (int k = 1; s21_fabs(term) > 1e-22L * s21_fabs(s); k += 2) {
+        sum += term / k;
+        term *= s2;
+    }
+    return 2 * sum + e * s21_ln2_l;
+}
+
+/**
+ * @brief e^r in long double precision for any finite r.
+ */
+static long double s21_exp_hp(long double r) {
+    if (is_nan(r)) return r;
+    if (r > 11357.0L) return s21_INF;
+    if (r < -11400.0L) return 0;
+    long long k = (long long)(r / s21_ln2_l + (r < 0 ? -0.5L : 0.5L));
+    long double rr = r - k * s21_ln2_l;
+    long double sum = 1, term = 1;
+    for (int p = 1; s21_fabs(term) > 1e-21L; p++) {
+        term = term * rr / p;
+        sum += term;
+    }
+    return sum * s21_fast_pow(2.0L, k);
+}
+
+/* below this the sqrt engine scales its input up, so the error terms of
+   the products in s21_mul_err cannot underflow */
+#define s21_SQRT_TINY 0x1.0p-900
+
+/**
+ * @brief Estimate of 1/sqrt(x) for finite x >= s21_SQRT_TINY: a bit-level
+ * guess and four Newton steps, a few ulp off.
+ */
+static inline double s21_rsqrt_est(double x) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5fe6eb50c7b537a9ULL - (bits >> 1);
+    double r;
+    memcpy(&r, &bits, sizeof(r));
+    double hx = 0.5 * x;
+    r = r * (1.5 - hx * r * r);
+    r = r * (1.5 - hx * r * r);
+    r = r * (1.5 - hx * r * r);
+    r = r * (1.5 - hx * r * r);
+    return r;
+}
+
+/**
+ * @brief Square root of finite positive x, correctly rounded.
+ *
+ * A Heron correction of x / sqrt(x) from the reciprocal estimate is within
+ * an ulp. Tuckerman's test then picks between it and its neighbours: s is
+ * too small when x > s * next(s), too large when x <= s * prev(s), and
+ * both products are compared exactly through s21_mul_err. No division and
+ * no data-dependent loop.
+ */
+static inline double s21_sqrt_d(double x) {
+    /* neither factor is 1, or the multiply would become conditional */
+    double scale = x < s21_SQRT_TINY ? 0x1.0p-54 : 2.0;
+    x *= x < s21_SQRT_TINY ? 0x1.0p108 : 0.25;
+    double r = s21_rsqrt_est(x);
+    double s = x * r;
+    s = s + 0.5 * r * (x - s * s);
+
+    uint64_t bits, up_bits, down_bits;
+    memcpy(&bits, &s, sizeof(bits));
+    up_bits = bits + 1;
+    down_bits = bits - 1;
+    double up, down;
+    memcpy(&up, &up_bits, sizeof(up));
+    memcpy(&down, &down_bits, sizeof(down));
+    double pu = s * up, pd = s * down;
+    /* x - pu and x - pd are exact, both products being close to x */
+    s = (x - pu) > s21_mul_err(s, up, pu) ? up : s;
+    s = (x - pd) <= s21_mul_err(s, down, pd) ? down : s;
+    return s * scale;
+}
+
+/**
+ * @brief log|x| for finite positive |x| as a normalized pair hi + *lo, the
+ * log half of s21_pow_kernel.
+ */
+static inline double s21_pow_log(double ax, double *lo_out) {
+    double lo, e, hi = s21_log_parts_acc(ax, &lo, &e, 1);
+    double t = e * s21_LN_2_HI;
+    double sh = t + hi;
+    double sl = ((t - sh) + hi) + (lo + e * s21_LN_2_LO);
+    /* lo holds the series past r and is not below an ulp of hi, so the
+       pair is renormalized to keep y * lo inside the exp reduction */
+    double lh = sh + sl;
+    *lo_out = (sh - lh) + sl;
+    return lh;
+}
+
+/**
+ * @brief e^(y * (lh + ll)), with the product carried as a rounded value
+ * and its error into the reduced exp argument.
+ */
+static inline double s21_pow_exp(double lh, double ll, double y) {
+    double p = y * lh;
+    double perr = s21_mul_err(y, lh, p) + y * ll;
+
+    int64_t kn;
+    double kd = s21_round_shift(p * s21_EXP_INV_LN2_64, &kn);
+    double r = (p - kd * s21_EXP_LN2_64_HI) - kd * s21_EXP_LN2_64_LO;
+    double res = s21_exp_tail(r + perr, kn);
+    res = p > 710.0 ? s21_INF : res;
+    return p < -746.0 ? 0.0 : res;
+}
+
+/**
+ * @brief |x|^y for finite positive |x| and finite y, as e^(y * log|x|) on
+ * the shared log and exp cores.
+ *
+ * y * log|x| reaches 745, so a log rounded to double would cost hundreds
+ * of ulp; both halves keep the extra bits.
+ */
+static inline double s21_pow_kernel(double ax, double y) {
+    double ll, lh = s21_pow_log(ax, &ll);
+    return s21_pow_exp(lh, ll, y);
+}
+
+/**
+ * @brief y / 2 less the nearest integer for |y| < 2^53: 0 for even
+ * integers, +-1/2 for odd ones and anything else otherwise. From 2^53 on
+ * every double is an even integer, which the callers select themselves.
+ */
+static inline double s21_half_frac(double y) {
+    /* 2^52 is even, and taking it off keeps y / 2 in s21_round_shift's
+       range; the doubles it applies to are all integers */
+    double off = __builtin_fabs(y) < TWO52 ? 0.0 : y < 0 ? -TWO52 : TWO52;
+    double z = (y - off) * 0.5;
+    int64_t kn;
+    return z - s21_round_shift(z, &kn);
+}
+
+s21_pow_base s21_pow_prepare(double base) {
+    s21_pow_base h = {base, 0.0, 0.0, s21_POW_FINITE};
+    if (is_nan(base)) {
+        h.kind = s21_POW_NAN;
+    } else if (base == 1.0) {
+        h.kind = s21_POW_ONE;
+    } else if (base == 0.0) {
+        h.kind = s21_POW_ZERO;
+    } else if (is_inf(base)) {
+        h.kind = s21_POW_INF;
+    } else {
+        h.log_hi = s21_pow_log(__builtin_fabs(base), &h.log_lo);
+    }
+    return h;
+}
+
+long double s21_pow_apply(const s21_pow_base *h, double exp) {
+    double base = h->base;
+    long double res;
+
+    if (exp == 0.0 || h->kind == s21_POW_ONE) {
+        res = 1.0;
+    } else if (is_nan(exp) || h->kind == s21_POW_NAN) {
+        res = s21_NAN;
+    } else if (is_inf(exp)) {
+        long double ab = s21_fabs(base);
+        if (ab == 1.0)
+            res = 1.0;
+        else
+            res = ((ab > 1.0) == (exp > 0)) ? s21_INF : 0.0;
+    } else if (h->kind == s21_POW_ZERO || h->kind == s21_POW_INF) {
+        /* 0^exp and inf^exp are a zero or an infinity, picked by exp sign */
+        s21_bool big = (h->kind == s21_POW_INF) == (exp > 0);
+        res = big ? s21_INF : 0.0L;
+        if (base < 0 || (base == 0 && __builtin_signbit(base))) {
+            if (s21_is_odd(exp)) res = -res;
+        }
+    } else if (base < 0 && !s21_is_int(exp)) {
+        res = s21_NAN;
+    } else if (s21_fabs(exp) <= 64 && s21_is_int(exp)) {
+        res = s21_fast_pow(base, (long long)exp);
+    } else {
+        res = s21_pow_exp(h->log_hi, h->log_lo, exp);
+        if (base < 0 && s21_is_odd(exp)) res = -res;
+    }
+
+    return res;
+}
+
+void s21_pow_apply_n(const s21_pow_base *h, const double *exp, double *out,
+                     size_t n) {
+    if (h->kind != s21_POW_FINITE) {
+        /* 0, 1, inf and NaN bases need no exp at all */
+        for (size_t i = 0; i < n; i++) out[i] = s21_pow_apply(h, exp[i]);
+        return;
+    }
+    /* everything the base decides is settled here, so the patch pass
+       only selects between constants per exponent */
+    double lh = h->log_hi, ll = h->log_lo, ab = __builtin_fabs(h->base);
+    double frac_mul = h->base < 0 ? s21_NAN : 1.0;
+    double odd_mul = h->base < 0 ? -1.0 : 1.0;
+    double at_inf = ab == 1.0 ? 1.0 : ab > 1.0 ? s21_INF : 0.0;
+    double at_minus_inf = ab == 1.0 ? 1.0 : ab > 1.0 ? 0.0 : s21_INF;
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) {
+            buf[j] = s21_pow_exp(lh, ll, exp[i + j]);
+        }
+        for (size_t j = 0; j < m; j++) {
+            double y = exp[i + j], res = buf[j], d = s21_half_frac(y);
+            /* a negative base keeps its sign for odd integer exponents
+               and has no real power for fractional ones */
+            double mul = d == 0 ? 1.0 : frac_mul;
+            mul = (d == 0.5 || d == -0.5) ? odd_mul : mul;
+            res *= __builtin_fabs(y) < 2 * TWO52 ? mul : 1.0;
+            res = y == s21_INF ? at_inf : res;
+            res = y == -s21_INF ? at_minus_inf : res;
+            res = y != y ? y : res;
+            out[i + j] = y == 0 ? 1.0 : res;
+        }
+    }
+}
+
+void s21_pow_n_fixed_exp(const double *in, double exp, double *out,
+                         size_t n) {
+    if (exp == 0.0 || is_nan(exp)) {
+        /* x^0 is 1 for every x, x^NaN is NaN unless x is 1 */
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (exp == 0.0 || in[i] == 1.0) ? 1.0 : s21_NAN;
+        }
+    } else if (exp == 1.0) {
+        for (size_t i = 0; i < n; i++) out[i] = in[i];
+    } else if (exp == 2.0) {
+        for (size_t i = 0; i < n; i++) out[i] = in[i] * in[i];
+    } else if (exp == -1.0) {
+        for (size_t i = 0; i < n; i++) out[i] = 1.0 / in[i];
+    } else if (exp == 0.5) {
+        for (size_t i = 0; i < n; i++) {
+            double x = in[i];
+            out[i] = (x > 0 && is_fin(x)) ? s21_sqrt_d(x)
+                     : (x == 0)           ? 0.0
+                     : is_inf(x)          ? s21_INF
+                                          : s21_NAN;
+        }
+    } else if (s21_is_int(exp) && s21_fabs(exp) <= 8) {
+        /* the bits of |k| fix the square-and-multiply chain once, so
+           every element runs the same multiplications in double; for
+           k < 0 a base large enough for x^|k| to overflow is inverted
+           first, since x^k may still be subnormal there */
+        int k = (int)exp, ak = k < 0 ? -k : k;
+        s21_bool b1 = ak & 1, b2 = ak & 2, b4 = ak & 4, b8 = ak & 8;
+        double inv_above = k < 0 ? s21_pow2i(1016 / ak) : s21_INF;
+        for (size_t i = 0; i < n; i++) {
+            double x = in[i], ax = __builtin_fabs(x);
+            double xs = ax > inv_above ? 1.0 / x : x;
+            double x2 = xs * xs, x4 = x2 * x2;
+            double r = (b1 ? xs : 1.0) * (b2 ? x2 : 1.0);
+            r *= b4 ? x4 : 1.0;
+            r *= b8 ? x4 * x4 : 1.0;
+            double q = k < 0 ? 1.0 / r : r;
+            out[i] = ax > inv_above ? r : q;
+        }
+    } else if (is_fin(exp)) {
+        /* the sign of a negative base survives odd integer exponents only,
+           so the bit is copied through a mask fixed by the exponent */
+        uint64_t odd_mask = s21_is_odd(exp) ? 0x8000000000000000ULL : 0;
+        double neg = s21_is_int(exp) ? 1.0 : s21_NAN;
+        double at_zero = exp > 0 ? 0.0 : s21_INF;
+        double at_inf = exp > 0 ? s21_INF : 0.0;
+        double buf[s21_BLOCK];
+        for (size_t i = 0; i < n; i += s21_BLOCK) {
+            size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+            for (size_t j = 0; j < m; j++) {
+                buf[j] = s21_pow_kernel(__builtin_fabs(in[i + j]), exp);
+            }
+            for (size_t j = 0; j < m; j++) {
+                double x = in[i + j], ax = __builtin_fabs(x), res = buf[j];
+                res = ax == 0 ? at_zero : res;
+                res = ax == s21_INF ? at_inf : res;
+                /* a finite negative base with a fractional exponent */
+                res *= (x < 0 && ax < s21_INF) ? neg : 1.0;
+                uint64_t rb, xb;
+                memcpy(&rb, &res, sizeof(rb));
+                memcpy(&xb, &x, sizeof(xb));
+                rb ^= xb & odd_mask;
+                memcpy(&res, &rb, sizeof(res));
+                out[i + j] = x != x ? x : res;
+            }
+        }
+    } else {
+        /* infinite exponents only compare |x| with 1 */
+        for (size_t i = 0; i < n; i++) {
+            s21_pow_base h = s21_pow_prepare(in[i]);
+            out[i] = s21_pow_apply(&h, exp);
+        }
+    }
+}
+
 long double s21_sin(double x) {
     long double res = 0, step, exp = 0;
     if (x == s21_NAN || x == -s21_INF || x == s21_INF) {
@@ -415,7 +1297,7 @@ long double s21_sin(double x) {
                     }
                     do {
                         step = s21_pow(-1, exp) * s21_pow(x, 2 * exp + 1) /
-                               s21_fact(2 * exp + 1);
+                               s21_factorial(2 * exp + 1);
                         res += step;
                         ++exp;
                     } while (step > s21_EPS || step < -s21_EPS);
@@ -451,7 +1333,2361 @@ long double s21_sqrt(double n) {
     return (n > s21_EPS) ? handle_special_cases(n, root) : s21_NAN;
 }
 
-long double s21_tan(double x) {
-    if (is_nan(x) || !is_fin(x)) return s21_NAN;
-    return s21_sin(x) / s21_cos(x);
+/**
+ * @brief 1/sqrt(x) for finite positive x, within an ulp. One more Newton
+ * step on the estimate, with the residual 1 - x r^2 carried exactly
+ * through two split products. Both ends of the range are scaled toward
+ * 1 by an even power of two first.
+ */
+static inline double s21_rsqrt_d(double x) {
+    /* Dekker's split of x overflows near the top of the range */
+    double scale = x < s21_SQRT_TINY ? 0x1.0p54 : 0.5;
+    scale = x > 0x1.0p900 ? 0x1.0p-54 : scale;
+    double f = x < s21_SQRT_TINY ? 0x1.0p108 : 0.25;
+    x *= x > 0x1.0p900 ? 0x1.0p-108 : f;
+    double r = s21_rsqrt_est(x);
+    double p = x * r, pe = s21_mul_err(x, r, p);
+    double t = p * r, te = s21_mul_err(p, r, t);
+    double res = ((1.0 - t) - te) - pe * r;
+    return (r + 0.5 * r * res) * scale;
+}
+
+/*
+ * The IEEE special cases, patched into the results of the engine. The
+ * batch forms apply them in a second pass over a local block: selected
+ * in the same loop, the engine's arithmetic would be moved under a branch
+ * and the loop would not be if-converted.
+ */
+static inline double s21_sqrt_fix(double x, double res) {
+    res = x == s21_INF ? x : res;
+    res = x == 0.0 ? x : res;
+    return ((x < 0.0) | (x != x)) ? s21_NAN : res;
+}
+
+/* 1/sqrt(+-0) is +-inf, 1/sqrt(inf) is +0 */
+static inline double s21_rsqrt_fix(double x, double res) {
+    res = x == s21_INF ? 0.0 : res;
+    res = x == 0.0 ? s21_copysign(s21_INF, x) : res;
+    return ((x < 0.0) | (x != x)) ? s21_NAN : res;
+}
+
+void s21_sqrt_n(const double *in, double *out, size_t n) {
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) buf[j] = s21_sqrt_d(in[i + j]);
+        for (size_t j = 0; j < m; j++) {
+            out[i + j] = s21_sqrt_fix(in[i + j], buf[j]);
+        }
+    }
+}
+
+void s21_rsqrt_n(const double *in, double *out, size_t n) {
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) buf[j] = s21_rsqrt_d(in[i + j]);
+        for (size_t j = 0; j < m; j++) {
+            out[i + j] = s21_rsqrt_fix(in[i + j], buf[j]);
+        }
+    }
+}
+
+/*
+ * (x, y, z) scaled to unit length in one pass: dot product, reciprocal
+ * square root and scaling. The direction does not change under a power
+ * of two, so vectors whose squares would overflow or underflow are scaled
+ * like in s21_hypot_kernel and never scaled back. Zero vectors are left
+ * as they are.
+ */
+static inline void s21_normalize3_kernel(double x, double y, double z,
+                                         double *ox, double *oy,
+                                         double *oz) {
+    double ax = __builtin_fabs(x), ay = __builtin_fabs(y);
+    double az = __builtin_fabs(z);
+    double big = ax > ay ? ax : ay;
+    big = big > az ? big : az;
+    double scale = big > 0x1.0p500 ? 0x1.0p-600 : 1.0;
+    scale = big < 0x1.0p-500 ? 0x1.0p600 : scale;
+    x *= scale;
+    y *= scale;
+    z *= scale;
+    double len2 = s21_FMA(x, x, s21_FMA(y, y, z * z));
+    /* the special cases change the input and add to the result, so the
+       engine's arithmetic stays unconditional; an infinite or NaN
+       component makes every output NaN */
+    double r = s21_rsqrt_d(len2 == 0.0 ? 1.0 : len2);
+    r += len2 - len2 == 0.0 ? 0.0 : s21_NAN;
+    *ox = x * r;
+    *oy = y * r;
+    *oz = z * r;
+}
+
+void s21_normalize3_n(const double *in, double *out, size_t n,
+                      s21_layout layout) {
+    if (layout == s21_LAYOUT_SOA) {
+        /* results go to local blocks, which saves the vectorizer the
+           overlap checks between three inputs and three outputs */
+        double bx[s21_BLOCK], by[s21_BLOCK], bz[s21_BLOCK];
+        for (size_t i = 0; i < n; i += s21_BLOCK) {
+            size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+            const double *x = in + i, *y = in + n + i, *z = in + 2 * n + i;
+            for (size_t j = 0; j < m; j++) {
+                s21_normalize3_kernel(x[j], y[j], z[j], &bx[j], &by[j],
+                                      &bz[j]);
+            }
+            memcpy(out + i, bx, m * sizeof(double));
+            memcpy(out + n + i, by, m * sizeof(double));
+            memcpy(out + 2 * n + i, bz, m * sizeof(double));
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            const double *v = in + 3 * i;
+            double *o = out + 3 * i;
+            s21_normalize3_kernel(v[0], v[1], v[2], &o[0], &o[1], &o[2]);
+        }
+    }
+}
+
+/*
+ * asin(x) = x + x z P(z) with z = x^2 on |x| <= 0.5, the tail of a minimax
+ * fit made with tools/remez (asin 0 0.5 25 --odd --rel), relative error
+ * 2.8e-17 before rounding in the evaluation.
+ */
+static const double s21_asin_coef[12] = {
+    0x1.55555555552abp-3, 0x1.333333337caa8p-4, 0x1.6db6db3c15054p-5,
+    0x1.f1c72dd4a2876p-6, 0x1.6e89d45a1a0e9p-6, 0x1.1c6d7e5e0ed6fp-6,
+    0x1.c6e1be76709bp-7,  0x1.8f67b55107347p-7, 0x1.a6c1a8fe1acd1p-8,
+    0x1.43210c9fa6d6dp-6, -0x1.0e6f76809a65p-6, 0x1.06e6a71d1326fp-5};
+
+/* pi/4, pi/2 and pi as hi + lo */
+#define s21_PIO4_HI 0x1.921fb54442d18p-1
+#define s21_PIO2_HI 0x1.921fb54442d18p+0
+#define s21_PIO2_LO 0x1.1a62633145c07p-54
+#define s21_PI_HI 0x1.921fb54442d18p+1
+#define s21_PI_LO 0x1.1a62633145c07p-53
+
+/**
+ * @brief Reduction shared by asin and acos. Up to |x| = 0.5 the
+ * polynomial takes x itself; past it, s = sqrt(z) with z = (1 - |x|) / 2,
+ * since asin(|x|) = pi/2 - 2 asin(s) and acos(|x|) = 2 asin(s).
+ * @return r with asin(t) = t + t * r for t = |x| or s; sets *big when the
+ * second form applies, and *s to s.
+ */
+static inline double s21_asin_reduce(double x, int *big, double *s) {
+    double a = __builtin_fabs(x), z = 0.5 - 0.5 * a;
+    *big = a > 0.5;
+    *s = s21_sqrt_d(z);
+    z = *big ? z : a * a;
+    return z * s21_HORNER12(z, s21_asin_coef);
+}
+
+/**
+ * @brief Splits sqrt(z) = hi + lo, where hi is s with its low 32 bits
+ * cleared so that 2 hi and hi * hi are exact. lo also absorbs the
+ * rounding of s, which would otherwise be doubled in the results.
+ */
+static inline double s21_sqrt_split(double z, double s, double *lo) {
+    uint64_t bits;
+    memcpy(&bits, &s, sizeof(bits));
+    bits &= 0xffffffff00000000ULL;
+    double hi;
+    memcpy(&hi, &bits, sizeof(hi));
+    *lo = (z - hi * hi) / (s + hi);
+    *lo = z == 0 ? 0.0 : *lo;
+    return hi;
+}
+
+/* every lane computes both forms, and |x| > 1 is masked to NaN at the
+   end, so the batch loops have no branches */
+static inline double s21_asin_kernel(double x) {
+    int big;
+    double s, lo, a = __builtin_fabs(x);
+    double r = s21_asin_reduce(x, &big, &s);
+    double hi = s21_sqrt_split(0.5 - 0.5 * a, s, &lo);
+    double p = 2.0 * s * r - (s21_PIO2_LO - 2.0 * lo);
+    double q = s21_PIO4_HI - 2.0 * hi;
+    double res = big ? s21_PIO4_HI - (p - q) : a + a * r;
+    res = a <= 1.0 ? res : s21_NAN;
+    return s21_copysign(res, x);
+}
+
+/**
+ * @brief acos without the reflection acos(x) = pi - acos(-x) as a second
+ * call: the sign of x only picks between results computed from |x|.
+ */
+static inline double s21_acos_kernel(double x) {
+    int big;
+    double s, lo, a = __builtin_fabs(x);
+    double r = s21_asin_reduce(x, &big, &s);
+    double hi = s21_sqrt_split(0.5 - 0.5 * a, s, &lo);
+    double small = s21_PIO2_HI - (x - (s21_PIO2_LO - x * r));
+    double pos = 2.0 * (hi + (r * s + lo));
+    double neg = s21_PI_HI - 2.0 * (s + (r * s - s21_PIO2_LO));
+    double res = big ? (x > 0 ? pos : neg) : small;
+    return a <= 1.0 ? res : s21_NAN;
+}
+
+long double s21_asin(double x) { return s21_asin_kernel(x); }
+
+long double s21_acos(double x) {
+    /* only finite arguments raise the domain error */
+    if (__builtin_fabs(x) > 1.0 && is_fin(x)) errno = EDOM;
+    return s21_acos_kernel(x);
+}
+
+void s21_asin_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_asin_kernel(in[i]);
+}
+
+void s21_acos_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_acos_kernel(in[i]);
+}
+
+/* 2/pi as a binary fraction, 64 bits per word, most significant first */
+static const uint64_t s21_two_over_pi[20] = {
+    0xa2f9836e4e441529ULL, 0xfc2757d1f534ddc0ULL, 0xdb6295993c439041ULL,
+    0xfe5163abdebbc561ULL, 0xb7246e3a424dd2e0ULL, 0x06492eea09d1921cULL,
+    0xfe1deb1cb129a73eULL, 0xe88235f52ebb4484ULL, 0xe99c7026b45f7e41ULL,
+    0x3991d639835339f4ULL, 0x9c845f8bbdf9283bULL, 0x1ff897ffde05980fULL,
+    0xef2f118b5a0a6d1fULL, 0x6d367ecf27cb09b7ULL, 0x4f463f669e5fea2dULL,
+    0x7527bac7ebe5f17bULL, 0x3d0739f78a5292eaULL, 0x6bfb5fb11f8d5d08ULL,
+    0x56033046fc7b6babULL, 0xf0cfbc209af4361dULL};
+
+/* pi/2 in 33-bit pieces, so n * piece is exact for n < 2^20 */
+#define s21_PIO2_1 1.57079632673412561417e+00
+#define s21_PIO2_2 6.07710050630396597660e-11
+#define s21_PIO2_3 2.02226624871116645580e-21
+#define s21_PIO2_3T 8.47842766036889956997e-32
+#define s21_INV_PIO2 6.36619772367581382433e-01
+#define s21_SINCOS_FAST 0x1.0p20
+
+/**
+ * @brief 64 bits of the 256-bit little-endian number p starting at bit b.
+ */
+static uint64_t s21_bits64(const uint64_t p[4], int b) {
+    int w = b / 64, sh = b % 64;
+    uint64_t lo = w < 4 ? p[w] >> sh : 0;
+    uint64_t hi = (sh && w + 1 < 4) ? p[w + 1] << (64 - sh) : 0;
+    return lo | hi;
+}
+
+/**
+ * @brief Payne-Hanek reduction of finite x >= 2^20: x = n * pi/2 + r with
+ * |r| <= pi/4, using a 192-bit window of 2/pi around the exponent of x.
+ * @return n mod 4.
+ */
+static int s21_rem_pio2_large(double x, double *r) {
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int e2 = (int)((bits >> 52) & 0x7ff) - 1075;
+    uint64_t m = (bits & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+
+    /* bits of 2/pi before i0 only add multiples of 4 to x * 2/pi */
+    int i0 = e2 - 1 > 1 ? e2 - 1 : 1;
+    int word = (i0 - 1) / 64, sh = (i0 - 1) % 64;
+    uint64_t win[3];
+    for (int j = 0; j < 3; j++) {
+        win[j] = s21_two_over_pi[word + j] << sh;
+        if (sh) win[j] |= s21_two_over_pi[word + j + 1] >> (64 - sh);
+    }
+
+    /* p = m * window, 53 x 192 bits */
+    uint64_t p[4];
+    unsigned __int128 acc = 0;
+    for (int j = 2; j >= 0; j--) {
+        acc += (unsigned __int128)m * win[j];
+        p[2 - j] = (uint64_t)acc;
+        acc >>= 64;
+    }
+    p[3] = (uint64_t)acc;
+
+    /* x * 2/pi = p / 2^s, keep 2 integer bits and 128 fraction bits */
+    int s = 191 - (e2 - i0);
+    int n = (int)(s21_bits64(p, s) & 3);
+    unsigned __int128 frac = (unsigned __int128)s21_bits64(p, s - 64) << 64 |
+                             s21_bits64(p, s - 128);
+    /* fold [1/2, 1) onto [-1/2, 0) in integer arithmetic, subtracting in
+       long double would cancel away the bits we need near a multiple */
+    int neg = (int)(frac >> 127);
+    if (neg) {
+        frac = -frac;
+        n = (n + 1) & 3;
+    }
+    long double f = (uint64_t)(frac >> 64) * 0x1.0p-64L +
+                    (uint64_t)frac * 0x1.0p-128L;
+    f *= 1.570796326794896619231321691639751442L;
+    *r = (double)(neg ? -f : f);
+    return n;
+}
+
+/**
+ * @brief sin(r) for |r| <= pi/4, fdlibm's degree 13 odd polynomial.
+ */
+static inline double s21_sin_poly(double r) {
+    static const double coef[6] = {
+        -1.66666666666666324348e-01, 8.33333333332248946124e-03,
+        -1.98412698298579493134e-04, 2.75573137070700676789e-06,
+        -2.50507602534068634195e-08, 1.58969099521155010221e-10};
+    double z = r * r, v = z * r;
+    return r + v * s21_HORNER6(z, coef);
+}
+
+/**
+ * @brief cos(r) for |r| <= pi/4, fdlibm's degree 14 even polynomial.
+ */
+static inline double s21_cos_poly(double r) {
+    static const double coef[6] = {
+        4.16666666666666019037e-02, -1.38888888888741095749e-03,
+        2.48015872894767294178e-05, -2.75573143513906633035e-07,
+        2.08757232129817482790e-09, -1.13596475577881948265e-11};
+    double z = r * r;
+    double p = z * s21_HORNER6(z, coef);
+    double hz = 0.5 * z, w = 1.0 - hz;
+    return w + (((1.0 - w) - hz) + z * p);
+}
+
+/**
+ * @brief Cody-Waite reduction by pi/2, valid for |x| < 2^20.
+ * @return n, with x = n * pi/2 + r.
+ */
+static inline int64_t s21_rem_pio2(double x, double *r) {
+    int64_t n;
+    double nd = s21_round_shift(x * s21_INV_PIO2, &n);
+    double r1 = x - nd * s21_PIO2_1;
+    *r = ((r1 - nd * s21_PIO2_2) - nd * s21_PIO2_3) - nd * s21_PIO2_3T;
+    return n;
+}
+
+/**
+ * @brief Shared sine/cosine core: sin and cos of r rotated by n quadrants.
+ */
+static inline void s21_sincos_quadrant(double r, int64_t n, double *s,
+                                       double *c) {
+    double sr = s21_sin_poly(r), cr = s21_cos_poly(r);
+    double sq = (n & 1) ? cr : sr, cq = (n & 1) ? sr : cr;
+    *s = (n & 2) ? -sq : sq;
+    *c = ((n + 1) & 2) ? -cq : cq;
+}
+
+/**
+ * @brief Branch-free sincos for |x| < 2^20; lanes outside that range get
+ * garbage and have to go through s21_sincos_kernel.
+ */
+static inline void s21_sincos_fast(double x, double *s, double *c) {
+    double r;
+    int64_t n = s21_rem_pio2(x, &r);
+    s21_sincos_quadrant(r, n, s, c);
+    *s = x == 0 ? x : *s;
+}
+
+static void s21_sincos_kernel(double x, double *s, double *c) {
+    if (__builtin_fabs(x) < s21_SINCOS_FAST) {
+        s21_sincos_fast(x, s, c);
+    } else if (!is_fin(x)) {
+        *s = *c = s21_NAN;
+    } else {
+        double r;
+        int n = s21_rem_pio2_large(__builtin_fabs(x), &r);
+        if (x < 0) {
+            r = -r;
+            n = -n;
+        }
+        s21_sincos_quadrant(r, n, s, c);
+    }
+}
+
+void s21_sincos(double x, long double *s, long double *c) {
+    double sd, cd;
+    s21_sincos_kernel(x, &sd, &cd);
+    *s = sd;
+    *c = cd;
+}
+
+/**
+ * @brief True when every |in[i]| is below s21_SINCOS_FAST, i.e. a block can
+ * take the vectorized path. Checked before any output is written, so the
+ * batch forms stay correct when outputs alias the input.
+ */
+static int s21_sincos_block_fast(const double *in, size_t n) {
+    int fast = 1;
+    for (size_t i = 0; i < n; i++) {
+        fast &= __builtin_fabs(in[i]) < s21_SINCOS_FAST;
+    }
+    return fast;
+}
+
+void s21_sincos_n(const double *in, double *s, double *c, size_t n) {
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        if (s21_sincos_block_fast(in + i, m)) {
+            for (size_t j = i; j < i + m; j++) {
+                s21_sincos_fast(in[j], &s[j], &c[j]);
+            }
+        } else {
+            for (size_t j = i; j < i + m; j++) {
+                s21_sincos_kernel(in[j], &s[j], &c[j]);
+            }
+        }
+    }
+}
+
+/*
+ * s21_sincos_seq runs s21_LANES interleaved recurrences, lane l producing
+ * samples l, l + s21_LANES, ..., each rotated by s21_LANES * dx. Every
+ * s21_BLOCK samples the lanes are re-seeded with exact values, so the
+ * drift never builds up over more than s21_BLOCK / s21_LANES steps.
+ */
+void s21_sincos_seq(double x0, double dx, double *s, double *c, size_t n) {
+    if (!(__builtin_fabs(dx) < s21_SINCOS_FAST / s21_LANES)) {
+        /* the step itself needs a slow reduction, nothing to gain */
+        for (size_t i = 0; i < n; i++) {
+            s21_sincos_kernel(s21_FMA((double)i, dx, x0), &s[i], &c[i]);
+        }
+        return;
+    }
+    /* rotation as x -= alpha * x -/+ beta * y, alpha = 1 - cos(step) in
+       its cancellation-free form, which keeps the rounding per step small */
+    double sh, ch;
+    s21_sincos_fast(0.5 * s21_LANES * dx, &sh, &ch);
+    double alpha = 2.0 * sh * sh, beta = 2.0 * sh * ch;
+    double x[s21_LANES], bs[s21_BLOCK], bc[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        double k = (double)i;
+        for (int l = 0; l < s21_LANES; l++) {
+            x[l] = s21_FMA(k + l, dx, x0);
+        }
+        if (s21_sincos_block_fast(x, s21_LANES)) {
+            for (int l = 0; l < s21_LANES; l++) {
+                s21_sincos_fast(x[l], &bs[l], &bc[l]);
+            }
+        } else {
+            for (int l = 0; l < s21_LANES; l++) {
+                s21_sincos_kernel(x[l], &bs[l], &bc[l]);
+            }
+        }
+        /* a dependence distance of s21_LANES lets this loop vectorize */
+        for (int j = s21_LANES; j < s21_BLOCK; j++) {
+            double ps = bs[j - s21_LANES], pc = bc[j - s21_LANES];
+            bs[j] = ps - (alpha * ps - beta * pc);
+            bc[j] = pc - (alpha * pc + beta * ps);
+        }
+        memcpy(s + i, bs, m * sizeof(double));
+        memcpy(c + i, bc, m * sizeof(double));
+    }
+}
+
+static inline double s21_atan2_kernel(double y, double x) {
+    double ay = __builtin_fabs(y), ax = __builtin_fabs(x);
+    double res = s21_atan_kernel(ay / ax);
+    /* 0/0 and inf/inf have no quotient but a well-defined angle; patching
+       the result rather than the quotient keeps the loop branch-free */
+    res = ay == 0 ? 0.0 : res;
+    res = ((ay == s21_INF) & (ax == s21_INF)) ? s21_atan_hi[2] : res;
+    res = s21_copysign(1.0, x) < 0 ? s21_PI_HI - (res - s21_PI_LO) : res;
+    res = s21_copysign(res, y);
+    return ((x != x) | (y != y)) ? x + y : res;
+}
+
+static inline double s21_hypot_kernel(double x, double y) {
+    double ax = __builtin_fabs(x), ay = __builtin_fabs(y);
+    double big = ax > ay ? ax : ay, small = ax > ay ? ay : ax;
+    /* bring the larger side near 1 so neither square can overflow or
+       lose the smaller side to underflow */
+    double scale = big > 0x1.0p500 ? 0x1.0p-600 : 1.0;
+    scale = big < 0x1.0p-500 ? 0x1.0p600 : scale;
+    big *= scale;
+    small *= scale;
+    double sum = big * big + small * small;
+    double res = sum > 0 ? s21_sqrt_d(sum) / scale : 0.0;
+    res = ((x != x) | (y != y)) ? x + y : res;
+    return ((ax == s21_INF) | (ay == s21_INF)) ? s21_INF : res;
+}
+
+long double s21_atan2(double y, double x) { return s21_atan2_kernel(y, x); }
+
+long double s21_hypot(double x, double y) { return s21_hypot_kernel(x, y); }
+
+void s21_atan2_n(const double *y, const double *x, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_atan2_kernel(y[i], x[i]);
+}
+
+void s21_hypot_n(const double *x, const double *y, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_hypot_kernel(x[i], y[i]);
+}
+
+void s21_cart2polar_n(const double *x, const double *y, double *r,
+                      double *theta, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        double xi = x[i], yi = y[i];
+        r[i] = s21_hypot_kernel(xi, yi);
+        theta[i] = s21_atan2_kernel(yi, xi);
+    }
+}
+
+void s21_polar2cart_n(const double *r, const double *theta, double *x,
+                      double *y, size_t n) {
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        double s, c;
+        if (s21_sincos_block_fast(theta + i, m)) {
+            for (size_t j = i; j < i + m; j++) {
+                double rj = r[j];
+                s21_sincos_fast(theta[j], &s, &c);
+                x[j] = rj * c;
+                y[j] = rj * s;
+            }
+        } else {
+            for (size_t j = i; j < i + m; j++) {
+                double rj = r[j];
+                s21_sincos_kernel(theta[j], &s, &c);
+                x[j] = rj * c;
+                y[j] = rj * s;
+            }
+        }
+    }
+}
+
+/* pi / 180 as a double and its tail */
+#define s21_DEG_HI 0x1.1df46a2529d39p-6
+#define s21_DEG_LO 0x1.5c1d8becdd291p-62
+/* below this the fast sinpi and degree reductions are exact */
+#define s21_PI_FAST 0x1.0p50
+
+/**
+ * @brief sin and cos of r * (a_hi + a_lo) turned by q quadrants, for an
+ * exact r with |r| <= quarter, where quarter * a is pi/4. The product is
+ * carried as two doubles and its tail corrects the polynomials.
+ */
+static inline void s21_sincos_scaled(double r, double a_hi, double a_lo,
+                                     double quarter, int64_t q, double *s,
+                                     double *c) {
+    double hi = r * a_hi, lo = s21_mul_err(r, a_hi, hi) + r * a_lo;
+    double sh = s21_sin_poly(hi), ch = s21_cos_poly(hi);
+    double sr = sh + ch * lo, cr = ch - sh * lo;
+    /* the two polynomials differ by an ulp at pi/4, keep |sin| = cos */
+    sr = __builtin_fabs(r) == quarter ? s21_copysign(cr, r) : sr;
+    double sq = (q & 1) ? cr : sr, cq = (q & 1) ? sr : cr;
+    *s = (q & 2) ? -sq : sq;
+    *c = ((q + 1) & 2) ? -cq : cq;
+}
+
+/**
+ * @brief x mod period, exact, for finite |x| >= s21_PI_FAST, where x is a
+ * multiple of 1/4. Keeps the sign of x.
+ */
+static double s21_reduce_period(double x, int64_t period) {
+    double ax = __builtin_fabs(x), res;
+    if (ax < 0x1.0p62) {
+        int64_t i = (int64_t)ax;
+        res = (double)(i % period) + (ax - (double)i);
+    } else {
+        /* an integer m * 2^e, reduced by doubling modulo period */
+        uint64_t bits;
+        memcpy(&bits, &ax, sizeof(bits));
+        int e = (int)((bits >> 52) & 0x7ff) - 1075;
+        uint64_t m = (bits & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+        int64_t rem = (int64_t)(m % (uint64_t)period);
+        while (e-- > 0) rem = 2 * rem % period;
+        res = (double)rem;
+    }
+    return x < 0 ? -res : res;
+}
+
+/* branch-free for |x| < s21_PI_FAST, like s21_sincos_fast */
+static inline void s21_sincospi_fast(double x, double *s, double *c) {
+    int64_t j;
+    double r = x - 0.5 * s21_round_shift(2.0 * x, &j);
+    s21_sincos_scaled(r, s21_PI_HI, s21_PI_LO, 0.25, j, s, c);
+}
+
+static inline void s21_sincosd_fast(double x, double *s, double *c) {
+    int64_t j;
+    double r = x - 90.0 * s21_round_shift(x * (1.0 / 90.0), &j);
+    s21_sincos_scaled(r, s21_DEG_HI, s21_DEG_LO, 45.0, j, s, c);
+}
+
+/**
+ * @brief Zeros as IEEE 754 sinPi and cosPi give them: sin(n) takes the
+ * sign of n, cos(n + 1/2) is +0.
+ */
+static inline void s21_sincospi_zeros(double x, double *s, double *c) {
+    *s = *s == 0 ? x * 0.0 : *s;
+    *c = *c + 0.0;
+}
+
+static void s21_sincospi_kernel(double x, int deg, double *s, double *c) {
+    double y = x;
+    if (!(__builtin_fabs(x) < s21_PI_FAST)) {
+        y = is_fin(x) ? s21_reduce_period(x, deg ? 360 : 2) : s21_NAN;
+    }
+    if (deg) {
+        s21_sincosd_fast(y, s, c);
+    } else {
+        s21_sincospi_fast(y, s, c);
+    }
+    s21_sincospi_zeros(x, s, c);
+}
+
+long double s21_sinpi(double x) {
+    double s, c;
+    s21_sincospi_kernel(x, 0, &s, &c);
+    return s;
+}
+
+long double s21_cospi(double x) {
+    double s, c;
+    s21_sincospi_kernel(x, 0, &s, &c);
+    return c;
+}
+
+long double s21_tanpi(double x) {
+    double s, c;
+    s21_sincospi_kernel(x, 0, &s, &c);
+    return s / c;
+}
+
+long double s21_sind(double x) {
+    double s, c;
+    s21_sincospi_kernel(x, 1, &s, &c);
+    return s;
+}
+
+long double s21_cosd(double x) {
+    double s, c;
+    s21_sincospi_kernel(x, 1, &s, &c);
+    return c;
+}
+
+/* which result of the sinpi family a batch writes */
+enum { s21_PI_SIN, s21_PI_COS, s21_PI_TAN };
+
+static void s21_sincospi_batch(const double *in, double *out, size_t n,
+                               int deg, int which) {
+    /* sines and cosines go to local blocks first; choosing between them
+       inside the loops would keep these from vectorizing */
+    double bs[s21_BLOCK], bc[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        const double *x = in + i;
+        int fast = 1;
+        for (size_t j = 0; j < m; j++) {
+            fast &= __builtin_fabs(x[j]) < s21_PI_FAST;
+        }
+        if (fast && deg) {
+            for (size_t j = 0; j < m; j++) {
+                s21_sincosd_fast(x[j], &bs[j], &bc[j]);
+                s21_sincospi_zeros(x[j], &bs[j], &bc[j]);
+            }
+        } else if (fast) {
+            for (size_t j = 0; j < m; j++) {
+                s21_sincospi_fast(x[j], &bs[j], &bc[j]);
+                s21_sincospi_zeros(x[j], &bs[j], &bc[j]);
+            }
+        } else {
+            for (size_t j = 0; j < m; j++) {
+                s21_sincospi_kernel(x[j], deg, &bs[j], &bc[j]);
+            }
+        }
+        if (which == s21_PI_SIN) {
+            memcpy(out + i, bs, m * sizeof(double));
+        } else if (which == s21_PI_COS) {
+            memcpy(out + i, bc, m * sizeof(double));
+        } else {
+            for (size_t j = 0; j < m; j++) out[i + j] = bs[j] / bc[j];
+        }
+    }
+}
+
+void s21_sinpi_n(const double *in, double *out, size_t n) {
+    s21_sincospi_batch(in, out, n, 0, s21_PI_SIN);
+}
+
+void s21_cospi_n(const double *in, double *out, size_t n) {
+    s21_sincospi_batch(in, out, n, 0, s21_PI_COS);
+}
+
+void s21_tanpi_n(const double *in, double *out, size_t n) {
+    s21_sincospi_batch(in, out, n, 0, s21_PI_TAN);
+}
+
+void s21_sind_n(const double *in, double *out, size_t n) {
+    s21_sincospi_batch(in, out, n, 1, s21_PI_SIN);
+}
+
+void s21_cosd_n(const double *in, double *out, size_t n) {
+    s21_sincospi_batch(in, out, n, 1, s21_PI_COS);
+}
+
+long double s21_tan(double x) {
+    if (is_nan(x) || !is_fin(x)) return s21_NAN;
+    return s21_sin(x) / s21_cos(x);
+}
+
+/* Chebyshev nodes fitted per segment, the highest degree is one less */
+#define s21_CHEB_NODES 16
+#define s21_CHEB_MAX_SEGS 4096
+
+/**
+ * @brief Chebyshev coefficients of f on [a, b] from its values at the
+ * s21_CHEB_NODES first-kind nodes. cosines holds cos(pi m / (2 nodes))
+ * for m < 4 nodes, which covers every angle the transform needs.
+ */
+static void s21_cheb_fit(double (*f)(double), double a, double b,
+                         const double *cosines, double *c) {
+    double fx[s21_CHEB_NODES], mid = 0.5 * (a + b), half = 0.5 * (b - a);
+    for (int k = 0; k < s21_CHEB_NODES; k++) {
+        fx[k] = f(mid + half * cosines[2 * k + 1]);
+    }
+    for (int j = 0; j < s21_CHEB_NODES; j++) {
+        long double sum = 0.0L;
+        for (int k = 0; k < s21_CHEB_NODES; k++) {
+            sum += (long double)fx[k] *
+                   cosines[j * (2 * k + 1) % (4 * s21_CHEB_NODES)];
+        }
+        c[j] = (double)((j ? 2.0L : 1.0L) * sum / s21_CHEB_NODES);
+    }
+}
+
+/**
+ * @brief Maps x to its segment and to t in [-1, 1] within it. Points
+ * outside [lo, hi] are clamped to the end segments.
+ */
+static inline int s21_cheb_locate(const s21_cheb *ch, double x, double *t) {
+    double u = (x - ch->lo) * ch->scale;
+    u = u > 0 ? u : 0.0;
+    u = u < ch->segs ? u : ch->segs;
+    int idx = (int)u;
+    idx = idx < ch->segs ? idx : ch->segs - 1;
+    *t = 2.0 * (u - idx) - 1.0;
+    return idx;
+}
+
+static inline double s21_cheb_kernel(const s21_cheb *ch, double x) {
+    double t;
+    const double *c = ch->coef + s21_cheb_locate(ch, x, &t) * ch->stride;
+    double b1 = 0.0, b2 = 0.0;
+    for (int k = ch->stride - 1; k >= 1; k--) {
+        double b0 = 2.0 * t * b1 - b2 + c[k];
+        b2 = b1;
+        b1 = b0;
+    }
+    double res = t * b1 - b2 + c[0];
+    return ((x >= ch->lo) & (x <= ch->hi)) ? res : s21_NAN;
+}
+
+/**
+ * @brief Largest error of ch against f at points between the nodes.
+ */
+static double s21_cheb_check(const s21_cheb *ch, double (*f)(double)) {
+    static const double probe[8] = {-1.0, -0.97, -0.83, -0.56,
+                                    -0.21, 0.13, 0.47, 0.92};
+    double width = (ch->hi - ch->lo) / ch->segs, err = 0.0;
+    for (int s = 0; s < ch->segs; s++) {
+        for (int p = 0; p < 8; p++) {
+            double x = ch->lo + width * (s + 0.5 * (probe[p] + 1.0));
+            double e = __builtin_fabs(s21_cheb_kernel(ch, x) - f(x));
+            err = (e > err || e != e) ? e : err;
+        }
+    }
+    return err;
+}
+
+s21_cheb *s21_cheb_build(double (*f)(double), double lo, double hi,
+                         double tol) {
+    if (!f || !is_fin(lo) || !is_fin(hi) || !(lo < hi) || !(tol > 0)) {
+        return NULL;
+    }
+    double *c = malloc(sizeof(double) * s21_CHEB_NODES * s21_CHEB_MAX_SEGS);
+    double cosines[4 * s21_CHEB_NODES];
+    for (int m = 0; m < 4 * s21_CHEB_NODES; m++) {
+        double sn;
+        s21_sincos_kernel(s21_M_PI * m / (2 * s21_CHEB_NODES), &sn,
+                          &cosines[m]);
+    }
+    s21_cheb *res = NULL;
+    for (int segs = 1; c && !res && segs <= s21_CHEB_MAX_SEGS; segs *= 2) {
+        double width = (hi - lo) / segs;
+        int degree = 0, converged = 1;
+        for (int s = 0; s < segs && converged; s++) {
+            double a = lo + width * s, b = s + 1 == segs ? hi : a + width;
+            double *cs = c + s * s21_CHEB_NODES;
+            s21_cheb_fit(f, a, b, cosines, cs);
+            /* the last two coefficients estimate what the fit leaves out */
+            double tail = __builtin_fabs(cs[s21_CHEB_NODES - 1]) +
+                          __builtin_fabs(cs[s21_CHEB_NODES - 2]);
+            converged = tail <= 0.25 * tol;
+            /* drop what the tolerance allows from the top */
+            double dropped = 0.0;
+            int d = s21_CHEB_NODES - 1;
+            while (d > 0 && dropped + __builtin_fabs(cs[d]) <= 0.25 * tol) {
+                dropped += __builtin_fabs(cs[d--]);
+            }
+            degree = d > degree ? d : degree;
+        }
+        if (!converged) continue;
+
+        int stride = degree + 1;
+        s21_cheb *ch = malloc(sizeof(*ch) + sizeof(double) * stride * segs);
+        if (!ch) break;
+        ch->lo = lo;
+        ch->hi = hi;
+        ch->scale = segs / (hi - lo);
+        ch->segs = segs;
+        ch->stride = stride;
+        for (int s = 0; s < segs; s++) {
+            memcpy(ch->coef + s * stride, c + s * s21_CHEB_NODES,
+                   sizeof(double) * stride);
+        }
+        ch->err = s21_cheb_check(ch, f);
+        if (ch->err <= tol) {
+            res = ch;
+        } else {
+            free(ch);
+        }
+    }
+    free(c);
+    return res;
+}
+
+long double s21_cheb_eval(const s21_cheb *ch, double x) {
+    return s21_cheb_kernel(ch, x);
+}
+
+void s21_cheb_eval_n(const s21_cheb *ch, const double *in, double *out,
+                     size_t n) {
+    /* Clenshaw runs with the degree in the outer loop, so each step is a
+       vector operation over a block of points from possibly different
+       segments; the fields are copied out because out may alias *ch as
+       far as the compiler knows */
+    const s21_cheb loc = *ch;
+    const double *coef = ch->coef;
+    double t[s21_BLOCK], b1[s21_BLOCK], b2[s21_BLOCK];
+    int base[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t len = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < len; j++) {
+            base[j] = s21_cheb_locate(&loc, in[i + j], &t[j]) * loc.stride;
+            b1[j] = b2[j] = 0.0;
+        }
+        for (int k = loc.stride - 1; k >= 1; k--) {
+            for (size_t j = 0; j < len; j++) {
+                double b0 = 2.0 * t[j] * b1[j] - b2[j] + coef[base[j] + k];
+                b2[j] = b1[j];
+                b1[j] = b0;
+            }
+        }
+        for (size_t j = 0; j < len; j++) {
+            double x = in[i + j];
+            double res = t[j] * b1[j] - b2[j] + coef[base[j]];
+            out[i + j] = ((x >= loc.lo) & (x <= loc.hi)) ? res : s21_NAN;
+        }
+    }
+}
+
+void s21_cheb_free(s21_cheb *ch) { free(ch); }
+
+/* tables start on their own cache line */
+#define s21_CACHE_LINE 64
+
+static inline int64_t s21_table_locate(const s21_table *tb, double x,
+                                       double *t) {
+    /* the cell is found by rounding and clamped in integers; clamping u
+       itself would split the batch loops into branches */
+    int64_t last = (int64_t)tb->size - 2, idx;
+    double u = (x - tb->lo) * tb->scale;
+    s21_round_shift(u - 0.5, &idx);
+    idx = idx > 0 ? idx : 0;
+    idx = idx < last ? idx : last;
+    *t = u - s21_int_to_double(idx);
+    return idx;
+}
+
+static inline double s21_table_linear(const s21_table *tb, double x) {
+    double t;
+    int64_t i = s21_table_locate(tb, x, &t);
+    double p0 = tb->val[i], p1 = tb->val[i + 1];
+    return p0 + t * (p1 - p0);
+}
+
+/**
+ * @brief Cubic Hermite interpolation between two (value, scaled slope)
+ * pairs stored next to each other.
+ */
+static inline double s21_table_cubic(const s21_table *tb, double x) {
+    /* indexed loads rather than offsets from a moving pointer, which
+       the vectorizer can turn into gathers */
+    double t;
+    int64_t i = 2 * s21_table_locate(tb, x, &t);
+    double p0 = tb->val[i], m0 = tb->val[i + 1];
+    double p1 = tb->val[i + 2], m1 = tb->val[i + 3], d = p1 - p0;
+    double c2 = 3.0 * d - 2.0 * m0 - m1, c3 = m0 + m1 - 2.0 * d;
+    return p0 + t * (m0 + t * (c2 + t * c3));
+}
+
+static inline double s21_table_kernel(const s21_table *tb, double x) {
+    double res = tb->interp == s21_TABLE_CUBIC ? s21_table_cubic(tb, x)
+                                               : s21_table_linear(tb, x);
+    return ((x >= tb->lo) & (x <= tb->hi)) ? res : s21_NAN;
+}
+
+s21_table *s21_table_build(long double (*func)(double), double lo, double hi,
+                           size_t size, s21_table_interp interp) {
+    int cubic = interp == s21_TABLE_CUBIC;
+    if (!func || !is_fin(lo) || !is_fin(hi) || !(lo < hi) ||
+        size < (size_t)(cubic ? 3 : 2) || size > INT_MAX ||
+        (interp != s21_TABLE_LINEAR && !cubic)) {
+        return NULL;
+    }
+    size_t head = (sizeof(s21_table) + s21_CACHE_LINE - 1) /
+                  s21_CACHE_LINE * s21_CACHE_LINE;
+    size_t bytes = head + sizeof(double) * size * (cubic ? 2 : 1);
+    bytes = (bytes + s21_CACHE_LINE - 1) / s21_CACHE_LINE * s21_CACHE_LINE;
+    s21_table *tb = aligned_alloc(s21_CACHE_LINE, bytes);
+    if (!tb) return NULL;
+    tb->lo = lo;
+    tb->hi = hi;
+    tb->scale = (size - 1) / (hi - lo);
+    tb->size = size;
+    tb->interp = interp;
+    tb->val = (double *)((char *)tb + head);
+
+    double h = (hi - lo) / (size - 1);
+    size_t step = cubic ? 2 : 1;
+    for (size_t i = 0; i < size; i++) {
+        double x = i + 1 == size ? hi : lo + h * i;
+        tb->val[step * i] = (double)func(x);
+    }
+    if (cubic) {
+        /* slopes in units of the spacing, central differences inside and
+           second order one-sided ones at the ends, so func is never
+           sampled outside [lo, hi] */
+        double *v = tb->val;
+        size_t n = 2 * (size - 1);
+        for (size_t i = 2; i < n; i += 2) {
+            v[i + 1] = 0.5 * (v[i + 2] - v[i - 2]);
+        }
+        v[1] = 0.5 * (4.0 * v[2] - 3.0 * v[0] - v[4]);
+        v[n + 1] = 0.5 * (3.0 * v[n] - 4.0 * v[n - 2] + v[n - 4]);
+    }
+
+    /* the error peaks between the samples, so probe there */
+    static const double probe[5] = {0.125, 0.3125, 0.5, 0.6875, 0.875};
+    tb->err = 0.0;
+    for (size_t i = 0; i + 1 < size; i++) {
+        for (int p = 0; p < 5; p++) {
+            double x = lo + h * (i + probe[p]);
+            double e = __builtin_fabs(s21_table_kernel(tb, x) -
+                                      (double)func(x));
+            tb->err = (e > tb->err || e != e) ? e : tb->err;
+        }
+    }
+    return tb;
+}
+
+long double s21_table_eval(const s21_table *tb, double x) {
+    return s21_table_kernel(tb, x);
+}
+
+void s21_table_eval_n(const s21_table *tb, const double *in, double *out,
+                      size_t n) {
+    /* copied so stores to out cannot alias the table fields; results go
+       through a local block first, since stores to out that might alias
+       the gathered values would keep the loops scalar */
+    const s21_table loc = *tb;
+    int cubic = loc.interp == s21_TABLE_CUBIC;
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        const double *x = in + i;
+        if (cubic) {
+            for (size_t j = 0; j < m; j++) {
+                buf[j] = s21_table_cubic(&loc, x[j]);
+            }
+        } else {
+            for (size_t j = 0; j < m; j++) {
+                buf[j] = s21_table_linear(&loc, x[j]);
+            }
+        }
+        for (size_t j = 0; j < m; j++) {
+            out[i + j] = ((x[j] >= loc.lo) & (x[j] <= loc.hi)) ? buf[j]
+                                                               : s21_NAN;
+        }
+    }
+}
+
+void s21_table_free(s21_table *tb) { free(tb); }
+
+/*
+ * Twiddle tables live in one block: a cache line of header (magic and n),
+ * then the cosines and the sines, each padded to whole cache lines. Files
+ * hold the same bytes, so a mapped file needs no unpacking.
+ */
+#define s21_TWIDDLE_MAGIC 0x3164697774313273ULL /* "s21twid1" */
+#define s21_TWIDDLE_MAX (SIZE_MAX / 64)
+
+typedef struct s21_twiddle_node {
+    s21_twiddles tw;
+    struct s21_twiddle_node *next;
+    void *block;
+    size_t bytes;
+    int mapped;
+} s21_twiddle_node;
+
+/* tables are pushed lock-free and never released */
+static _Atomic(s21_twiddle_node *) s21_twiddle_cache;
+
+/* doubles per array, rounded up to whole cache lines */
+static size_t s21_twiddle_stride(size_t n) {
+    size_t per = s21_CACHE_LINE / sizeof(double);
+    return (n + per - 1) / per * per;
+}
+
+static size_t s21_twiddle_bytes(size_t n) {
+    return s21_CACHE_LINE + 2 * sizeof(double) * s21_twiddle_stride(n);
+}
+
+/**
+ * @brief cos and sin of 2 pi k / n. 4k is split in integers into a
+ * quadrant and a remainder of at most n / 2, so the reduced angle
+ * |r| <= pi/4 is exact up to its long double rounding; its tail then
+ * corrects the polynomials to first order.
+ */
+static void s21_twiddle(size_t k, size_t n, double *c, double *s) {
+    size_t t = 4 * k, q = t / n, rem = t % n;
+    long double num = (long double)rem;
+    if (2 * rem > n) {
+        q++;
+        num -= (long double)n;
+    }
+    long double r = num / n * 1.5707963267948966192313216916397514L;
+    double hi = (double)r, lo = (double)(r - hi);
+    double sh = s21_sin_poly(hi), ch = s21_cos_poly(hi);
+    double sr = sh + ch * lo, cr = ch - sh * lo;
+    /* the two polynomials differ by an ulp at pi/4, keep sin = cos there */
+    sr = 2 * rem == n ? cr : sr;
+    double sq = (q & 1) ? cr : sr, cq = (q & 1) ? sr : cr;
+    /* + 0.0 turns the -0 of the quadrant flips into +0 */
+    *s = ((q & 2) ? -sq : sq) + 0.0;
+    *c = (((q + 1) & 2) ? -cq : cq) + 0.0;
+}
+
+static s21_twiddle_node *s21_twiddle_node_new(size_t n, void *block,
+                                              size_t bytes, int mapped) {
+    s21_twiddle_node *node = malloc(sizeof(*node));
+    if (!node) return NULL;
+    node->tw.n = n;
+    node->tw.re = (const double *)((char *)block + s21_CACHE_LINE);
+    node->tw.im = node->tw.re + s21_twiddle_stride(n);
+    node->next = NULL;
+    node->block = block;
+    node->bytes = bytes;
+    node->mapped = mapped;
+    return node;
+}
+
+static void s21_twiddle_node_free(s21_twiddle_node *node) {
+    if (node->mapped) {
+        munmap(node->block, node->bytes);
+    } else {
+        free(node->block);
+    }
+    free(node);
+}
+
+static s21_twiddle_node *s21_twiddle_compute(size_t n) {
+    size_t bytes = s21_twiddle_bytes(n), stride = s21_twiddle_stride(n);
+    char *block = aligned_alloc(s21_CACHE_LINE, bytes);
+    if (!block) return NULL;
+    /* padding included, the block may be written out as it is */
+    memset(block, 0, bytes);
+    uint64_t head[2] = {s21_TWIDDLE_MAGIC, n};
+    memcpy(block, head, sizeof(head));
+    double *re = (double *)(block + s21_CACHE_LINE), *im = re + stride;
+    for (size_t k = 0; k < n; k++) s21_twiddle(k, n, &re[k], &im[k]);
+    s21_twiddle_node *node = s21_twiddle_node_new(n, block, bytes, 0);
+    if (!node) free(block);
+    return node;
+}
+
+static s21_twiddle_node *s21_twiddle_find(s21_twiddle_node *node, size_t n) {
+    while (node && node->tw.n != n) node = node->next;
+    return node;
+}
+
+/**
+ * @brief Adds a node to the cache. When another thread got a table for
+ * the same n in first, the node is dropped and that table returned.
+ */
+static s21_twiddle_node *s21_twiddle_publish(s21_twiddle_node *node) {
+    s21_twiddle_node *head = atomic_load(&s21_twiddle_cache);
+    do {
+        s21_twiddle_node *hit = s21_twiddle_find(head, node->tw.n);
+        if (hit) {
+            s21_twiddle_node_free(node);
+            return hit;
+        }
+        node->next = head;
+    } while (!atomic_compare_exchange_weak(&s21_twiddle_cache, &head, node));
+    return node;
+}
+
+/* maps path when it holds the table for n, NULL otherwise */
+static s21_twiddle_node *s21_twiddle_load(size_t n, const char *path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    size_t bytes = s21_twiddle_bytes(n);
+    struct stat st;
+    void *map = MAP_FAILED;
+    if (!fstat(fd, &st) && (uint64_t)st.st_size == bytes) {
+        map = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+    uint64_t head[2];
+    memcpy(head, map, sizeof(head));
+    s21_twiddle_node *node = NULL;
+    if (head[0] == s21_TWIDDLE_MAGIC && head[1] == n) {
+        node = s21_twiddle_node_new(n, map, bytes, 1);
+    }
+    if (!node) munmap(map, bytes);
+    return node;
+}
+
+/* best effort; a temporary file and a rename keep readers from ever
+   mapping a partly written table. mkstemp gives every caller its own
+   temporary, so threads storing the same table cannot truncate each
+   other's file. The file keeps the owner-only mode mkstemp creates it
+   with: the umask cannot be read without changing it, which would race
+   with other threads */
+static void s21_twiddle_store(const s21_twiddle_node *node,
+                              const char *path) {
+    char tmp[4096];
+    int len = snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+    if (len < 0 || (size_t)len >= sizeof(tmp)) return;
+    int fd = mkstemp(tmp);
+    if (fd < 0) return;
+    FILE *f = fdopen(fd, "wb");
+    if (!f) {
+        close(fd);
+        remove(tmp);
+        return;
+    }
+    int ok = fwrite(node->block, 1, node->bytes, f) == node->bytes;
+    ok &= fclose(f) == 0;
+    if (!ok || rename(tmp, path)) remove(tmp);
+}
+
+/* the cached node for n, computed and published on a miss */
+static s21_twiddle_node *s21_twiddle_get(size_t n) {
+    s21_twiddle_node *hit =
+        s21_twiddle_find(atomic_load(&s21_twiddle_cache), n);
+    if (hit) return hit;
+    s21_twiddle_node *node = s21_twiddle_compute(n);
+    return node ? s21_twiddle_publish(node) : NULL;
+}
+
+const s21_twiddles *s21_twiddles_get(size_t n) {
+    if (n == 0 || n > s21_TWIDDLE_MAX) return NULL;
+    s21_twiddle_node *node = s21_twiddle_get(n);
+    return node ? &node->tw : NULL;
+}
+
+const s21_twiddles *s21_twiddles_map(size_t n, const char *path) {
+    if (!path || n == 0 || n > s21_TWIDDLE_MAX) return s21_twiddles_get(n);
+    s21_twiddle_node *node =
+        s21_twiddle_find(atomic_load(&s21_twiddle_cache), n);
+    if (!node) {
+        s21_twiddle_node *file = s21_twiddle_load(n, path);
+        if (file) return &s21_twiddle_publish(file)->tw;
+        node = s21_twiddle_get(n);
+        if (!node) return NULL;
+    }
+    /* a table computed here or by an earlier get still has to reach
+       path, unless the file already holds it */
+    if (!node->mapped) {
+        s21_twiddle_node *file = s21_twiddle_load(n, path);
+        if (file) {
+            s21_twiddle_node_free(file);
+        } else {
+            s21_twiddle_store(node, path);
+        }
+    }
+    return &node->tw;
+}
+
+/*
+ * Rounding for the batch forms. Vector rounding instructions are used
+ * through intrinsics: vrndscalepd with AVX-512, roundpd with AVX or
+ * SSE4.1. The vectorizer leaves floor and trunc calls scalar under the
+ * default -ftrapping-math. Targets without them round by adding and
+ * subtracting 2^52, which vectorizes with plain SSE2. round() is built on
+ * trunc in both cases, since no instruction rounds halfway cases away
+ * from zero.
+ */
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#define s21_VROUND_LANES 8
+#define s21_VROUND(src, dst, imm) \
+    _mm512_storeu_pd((dst), _mm512_roundscale_pd(_mm512_loadu_pd(src), (imm)))
+#elif defined(__AVX__)
+#include <immintrin.h>
+#define s21_VROUND_LANES 4
+#define s21_VROUND(src, dst, imm) \
+    _mm256_storeu_pd((dst), _mm256_round_pd(_mm256_loadu_pd(src), (imm)))
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define s21_VROUND_LANES 2
+#define s21_VROUND(src, dst, imm) \
+    _mm_storeu_pd((dst), _mm_round_pd(_mm_loadu_pd(src), (imm)))
+#endif
+
+#define s21_TWO52 0x1.0p52
+
+/*
+ * x rounded to the nearest integer, ties to even. Adding 2^52 rounds
+ * |x| below it; larger |x| are integers already and get 0 added.
+ *
+ * The helpers select constants and always do the arithmetic: a select of
+ * the results, or "r - (c ? 1.0 : 0.0)", is turned into a branch around
+ * the arithmetic, and then the loops are not if-converted. The selects
+ * are of doubles, since SSE2 cannot turn a comparison into a 64-bit 0/1.
+ */
+static inline double s21_nearest_d(double x) {
+    double a = __builtin_fabs(x);
+    double c = a < s21_TWO52 ? s21_TWO52 : 0.0;
+    return s21_copysign((a + c) - c, x);
+}
+
+/* the results have the sign of x; copysign keeps -0 from becoming +0 */
+static inline double s21_floor_d(double x) {
+    double r = s21_nearest_d(x);
+    return s21_copysign(r + (r > x ? -1.0 : 0.0), x);
+}
+
+static inline double s21_ceil_d(double x) {
+    double r = s21_nearest_d(x);
+    return s21_copysign(r + (r < x ? 1.0 : 0.0), x);
+}
+
+static inline double s21_trunc_d(double x) {
+    double a = __builtin_fabs(x), r = __builtin_fabs(s21_nearest_d(x));
+    return s21_copysign(r + (r > a ? -1.0 : 0.0), x);
+}
+
+/* t = trunc(x) turned into round(x); x - t is exact */
+static inline double s21_round_fix(double x, double t) {
+    double a = __builtin_fabs(t);
+    a += __builtin_fabs(x - t) >= 0.5 ? 1.0 : 0.0;
+    return s21_copysign(a, x);
+}
+
+#ifdef s21_VROUND_LANES
+#define s21_VROUND_LOOP(in, out, n, imm)                                \
+    size_t i = 0;                                                       \
+    for (; i + s21_VROUND_LANES <= (n); i += s21_VROUND_LANES) {        \
+        s21_VROUND((in) + i, (out) + i, (imm) | _MM_FROUND_NO_EXC);     \
+    }
+#else
+#define s21_VROUND_LOOP(in, out, n, imm) size_t i = 0;
+#endif
+
+static void s21_floor_block(const double *in, double *out, size_t n) {
+    s21_VROUND_LOOP(in, out, n, _MM_FROUND_TO_NEG_INF)
+    for (; i < n; i++) out[i] = s21_floor_d(in[i]);
+}
+
+static void s21_ceil_block(const double *in, double *out, size_t n) {
+    s21_VROUND_LOOP(in, out, n, _MM_FROUND_TO_POS_INF)
+    for (; i < n; i++) out[i] = s21_ceil_d(in[i]);
+}
+
+static void s21_trunc_block(const double *in, double *out, size_t n) {
+    s21_VROUND_LOOP(in, out, n, _MM_FROUND_TO_ZERO)
+    for (; i < n; i++) out[i] = s21_trunc_d(in[i]);
+}
+
+/* out must not overlap in */
+static void s21_round_block(const double *in, double *out, size_t n,
+                            s21_round_mode mode) {
+    switch (mode) {
+        case s21_ROUND_FLOOR:
+            s21_floor_block(in, out, n);
+            break;
+        case s21_ROUND_CEIL:
+            s21_ceil_block(in, out, n);
+            break;
+        case s21_ROUND_NEAREST:
+            s21_trunc_block(in, out, n);
+            for (size_t i = 0; i < n; i++) {
+                out[i] = s21_round_fix(in[i], out[i]);
+            }
+            break;
+        default:
+            s21_trunc_block(in, out, n);
+    }
+}
+
+void s21_floor_n(const double *in, double *out, size_t n) {
+    s21_floor_block(in, out, n);
+}
+
+void s21_ceil_n(const double *in, double *out, size_t n) {
+    s21_ceil_block(in, out, n);
+}
+
+void s21_trunc_n(const double *in, double *out, size_t n) {
+    s21_trunc_block(in, out, n);
+}
+
+void s21_round_n(const double *in, double *out, size_t n) {
+    /* trunc goes to a local block, out may alias in */
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        s21_round_block(in + i, buf, m, s21_ROUND_NEAREST);
+        memcpy(out + i, buf, m * sizeof(double));
+    }
+}
+
+/* NaN gives 0, values past the range of the type saturate */
+static inline int32_t s21_sat_i32(double r) {
+    r = r == r ? r : 0.0;
+    r = r < INT32_MIN ? INT32_MIN : r;
+    r = r > INT32_MAX ? INT32_MAX : r;
+    return (int32_t)r;
+}
+
+static inline int64_t s21_sat_i64(double r) {
+    /* 2^63 itself does not fit, the largest double below it does */
+    double c = r == r ? r : 0.0;
+    c = c < -0x1.0p63 ? -0x1.0p63 : c;
+    c = c < 0x1.0p63 ? c : 0x1.fffffffffffffp62;
+    int64_t v = (int64_t)c;
+    return r >= 0x1.0p63 ? INT64_MAX : v;
+}
+
+void s21_to_int32_n(const double *in, int32_t *out, size_t n,
+                    s21_round_mode mode) {
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        s21_round_block(in + i, buf, m, mode);
+        for (size_t j = 0; j < m; j++) out[i + j] = s21_sat_i32(buf[j]);
+    }
+}
+
+void s21_to_int64_n(const double *in, int64_t *out, size_t n,
+                    s21_round_mode mode) {
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        s21_round_block(in + i, buf, m, mode);
+        for (size_t j = 0; j < m; j++) out[i + j] = s21_sat_i64(buf[j]);
+    }
+}
+
+/* quotients below this take the vectorized path of s21_fmod_n_fixed */
+#define s21_FMOD_FAST 0x1.0p40
+
+s21_fmod_divisor s21_fmod_prepare(double y) {
+    s21_fmod_divisor d;
+    const double split = 0x1.0p27 + 1.0;
+    double t = split * __builtin_fabs(y);
+    d.y = y;
+    d.ay = __builtin_fabs(y);
+    d.inv = 1.0 / d.ay;
+    d.ay_hi = t - (t - d.ay);
+    d.ay_lo = d.ay - d.ay_hi;
+    /* the error terms of q * |y| underflow for tiny divisors; zero,
+       infinite and NaN divisors go through the exact path as well */
+    d.limit = d.ay >= 0x1.0p-960 && d.ay <= 0x1.0p960 ? s21_FMOD_FAST : 0.0;
+    return d;
+}
+
+/*
+ * ax - q * |y| rounded once, for an integer q below s21_FMOD_FAST. Without
+ * FMA the product is split as in s21_mul_err, with |y| split beforehand,
+ * and the difference is carried as two doubles. Both error terms are
+ * multiples of the smaller ulp of ax and q * |y| well below 2^53 of it, so
+ * their difference is exact and only the last addition rounds.
+ */
+static inline double s21_fmod_rem(const s21_fmod_divisor *d, double ax,
+                                  double q) {
+#if defined(__FMA__) || defined(__aarch64__)
+    return __builtin_fma(-q, d->ay, ax);
+#else
+    const double split = 0x1.0p27 + 1.0;
+    double t = split * q, qh = t - (t - q), ql = q - qh;
+    double p = q * d->ay;
+    double e = ((qh * d->ay_hi - p) + qh * d->ay_lo + ql * d->ay_hi) +
+               ql * d->ay_lo;
+    double s = ax - p, z = s - ax;
+    double err = (ax - (s - z)) + (-p - z);
+    return s + (err - e);
+#endif
+}
+
+/*
+ * fmod for |x| / |y| below d->limit, exact. The quotient from the
+ * reciprocal is off by at most one; the sign of the first remainder, or
+ * it reaching |y|, shows which way, and the second one is exact.
+ */
+static inline double s21_fmod_fast(const s21_fmod_divisor *d, double x) {
+    double ax = __builtin_fabs(x);
+    double q = s21_trunc_d(ax * d->inv);
+    double r = s21_fmod_rem(d, ax, q);
+    q += (r < 0.0 ? -1.0 : 0.0) + (r >= d->ay ? 1.0 : 0.0);
+    return s21_copysign(s21_fmod_rem(d, ax, q), x);
+}
+
+/*
+ * Exact fmod with the C special cases, by long division of the
+ * significands. x = mx 2^ex and y = my 2^ey with integer mx, my; the
+ * remainder of mx 2^(ex - ey) by my is built 11 bits at a time so the
+ * shifted value stays within 64 bits.
+ */
+static double s21_fmod_exact(double x, double y) {
+    if (is_nan(x) || is_nan(y) || is_inf(x) || y == 0.0) return s21_NAN;
+    if (is_inf(y) || __builtin_fabs(x) < __builtin_fabs(y)) return x;
+    uint64_t ux, uy;
+    memcpy(&ux, &x, sizeof(ux));
+    memcpy(&uy, &y, sizeof(uy));
+    int ex = (int)((ux >> 52) & 0x7ff), ey = (int)((uy >> 52) & 0x7ff);
+    uint64_t mx = ux & 0x000fffffffffffffULL, my = uy & 0x000fffffffffffffULL;
+    /* subnormals have exponent 1 and no implicit bit */
+    mx |= ex ? 0x0010000000000000ULL : 0;
+    my |= ey ? 0x0010000000000000ULL : 0;
+    ex += !ex;
+    ey += !ey;
+
+    uint64_t rem = mx % my;
+    for (int k = ex - ey; k > 0; k -= 11) {
+        int sh = k < 11 ? k : 11;
+        rem = (rem << sh) % my;
+    }
+    /* 2^(ey - 1075), a subnormal below 2^-1022 */
+    uint64_t sbits = ey > 52 ? (uint64_t)(ey - 52) << 52
+                             : 1ULL << (ey - 1);
+    double scale, res;
+    memcpy(&scale, &sbits, sizeof(scale));
+    res = (double)rem * scale;
+    return s21_copysign(res, x);
+}
+
+/* true when every element of the block can keep the fast result */
+static int s21_fmod_block_fast(const s21_fmod_divisor *d, const double *in,
+                               size_t n) {
+    int fast = 1;
+    for (size_t i = 0; i < n; i++) {
+        fast &= __builtin_fabs(in[i]) * d->inv < d->limit;
+    }
+    return fast;
+}
+
+void s21_fmod_n_fixed(const s21_fmod_divisor *d, const double *in,
+                      double *out, size_t n) {
+    /* results go to a local block first, out may alias in */
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) buf[j] = s21_fmod_fast(d, in[i + j]);
+        if (!s21_fmod_block_fast(d, in + i, m)) {
+            for (size_t j = 0; j < m; j++) {
+                double x = in[i + j];
+                if (!(__builtin_fabs(x) * d->inv < d->limit)) {
+                    buf[j] = s21_fmod_exact(x, d->y);
+                }
+            }
+        }
+        memcpy(out + i, buf, m * sizeof(double));
+    }
+}
+
+/*
+ * Saturating integer abs. The most negative value has no positive
+ * counterpart and becomes the maximum, the clamp s21_abs gets from
+ * widening. Vector forms take |x| with pabs, which leaves the minimum as
+ * it is, then an unsigned min against the maximum: the minimum reads as
+ * max + 1 there and every other |x| is below it.
+ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define s21_VINT_BYTES 32
+#define s21_VINT_LOAD(p) _mm256_loadu_si256((const __m256i *)(p))
+#define s21_VINT_STORE(p, v) _mm256_storeu_si256((__m256i *)(p), (v))
+#define s21_VABS_SAT(bits, v)                     \
+    _mm256_min_epu##bits(_mm256_abs_epi##bits(v), \
+                         _mm256_set1_epi##bits(INT##bits##_MAX))
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#define s21_VINT_BYTES 16
+#define s21_VINT_LOAD(p) _mm_loadu_si128((const __m128i *)(p))
+#define s21_VINT_STORE(p, v) _mm_storeu_si128((__m128i *)(p), (v))
+#define s21_VABS_SAT(bits, v)               \
+    _mm_min_epu##bits(_mm_abs_epi##bits(v), \
+                      _mm_set1_epi##bits(INT##bits##_MAX))
+#endif
+
+#ifdef s21_VINT_BYTES
+#define s21_VABS_LOOP(bits, in, out, n)                              \
+    for (; i + s21_VINT_BYTES * 8 / (bits) <= (n);                   \
+         i += s21_VINT_BYTES * 8 / (bits)) {                         \
+        s21_VINT_STORE((out) + i,                                    \
+                       s21_VABS_SAT(bits, s21_VINT_LOAD((in) + i))); \
+    }
+#else
+#define s21_VABS_LOOP(bits, in, out, n)
+#endif
+
+/* the portable loop finishes the tail and vectorizes on its own */
+#define s21_ABS_SAT_TAIL(bits, in, out, n)                            \
+    for (; i < (n); i++) {                                            \
+        uint##bits##_t u = (uint##bits##_t)(in)[i];                   \
+        uint##bits##_t a = (in)[i] < 0 ? (uint##bits##_t)(0 - u) : u; \
+        a = a > INT##bits##_MAX ? INT##bits##_MAX : a;                \
+        (out)[i] = (int##bits##_t)a;                                  \
+    }
+
+void s21_abs_i8_n(const int8_t *in, int8_t *out, size_t n) {
+    size_t i = 0;
+    s21_VABS_LOOP(8, in, out, n)
+    s21_ABS_SAT_TAIL(8, in, out, n)
+}
+
+void s21_abs_i16_n(const int16_t *in, int16_t *out, size_t n) {
+    size_t i = 0;
+    s21_VABS_LOOP(16, in, out, n)
+    s21_ABS_SAT_TAIL(16, in, out, n)
+}
+
+void s21_abs_i32_n(const int32_t *in, int32_t *out, size_t n) {
+    size_t i = 0;
+    s21_VABS_LOOP(32, in, out, n)
+    s21_ABS_SAT_TAIL(32, in, out, n)
+}
+
+void s21_abs_i64_n(const int64_t *in, int64_t *out, size_t n) {
+    size_t i = 0;
+    /* 64-bit pabs and unsigned min need AVX-512 */
+#if defined(__AVX512F__)
+    for (; i + 8 <= n; i += 8) {
+        __m512i v = _mm512_loadu_si512((const void *)(in + i));
+        v = _mm512_min_epu64(_mm512_abs_epi64(v),
+                             _mm512_set1_epi64(INT64_MAX));
+        _mm512_storeu_si512((void *)(out + i), v);
+    }
+#endif
+    s21_ABS_SAT_TAIL(64, in, out, n)
+}
+
+/*
+ * Integer square roots. The double root of n is correctly rounded and
+ * n rounds to 53 bits on the way in, so its integer part is within one of
+ * floor(sqrt(n)); a compare in each direction fixes it. Below 2^53 the
+ * conversion is exact and no correction is needed.
+ */
+uint32_t s21_isqrt_u32(uint32_t n) {
+    return (uint32_t)s21_sqrt_d((double)n);
+}
+
+uint64_t s21_isqrt_u64(uint64_t n) {
+    uint64_t r = (uint64_t)s21_sqrt_d((double)n);
+    /* sqrt(2^64) rounds to 2^32, one above the largest root */
+    r = r > UINT32_MAX ? UINT32_MAX : r;
+    r -= r * r > n;
+    r += r < UINT32_MAX && (r + 1) * (r + 1) <= n;
+    return r;
+}
+
+void s21_isqrt_u32_n(const uint32_t *in, uint32_t *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_isqrt_u32(in[i]);
+}
+
+void s21_isqrt_u64_n(const uint64_t *in, uint64_t *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_isqrt_u64(in[i]);
+}
+
+int s21_ilog2(uint64_t n) { return n ? 63 - __builtin_clzll(n) : -1; }
+
+/* 10^k for k = 0..19, all of them that fit in 64 bits */
+static const uint64_t s21_pow10_u64[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+    1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL};
+
+/*
+ * (ilog2(n) + 1) * 1233 / 4096 is floor(log10(2^(ilog2(n) + 1))), a
+ * digit count that is either right or one too large; the table decides.
+ * n = 0 comes out as -1 like in s21_ilog2.
+ */
+int s21_ilog10(uint64_t n) {
+    int t = ((s21_ilog2(n) + 1) * 1233) >> 12;
+    return t - (n < s21_pow10_u64[t]);
+}
+
+void s21_ilog2_n(const uint64_t *in, int *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_ilog2(in[i]);
+}
+
+void s21_ilog10_n(const uint64_t *in, int *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_ilog10(in[i]);
+}
+
+/* n! for n = 0..170 rounded to double; 171! overflows */
+static const double s21_fact_tab[171] = {
+    0x1p0, 0x1p0, 0x1p1, 0x1.8p2, 0x1.8p4, 0x1.ep6, 0x1.68p9, 0x1.3bp12,
+    0x1.3bp15, 0x1.626p18, 0x1.baf8p21, 0x1.308a8p25, 0x1.c8cfcp28,
+    0x1.7328ccp32, 0x1.44c3b28p36, 0x1.30777758p40, 0x1.30777758p44,
+    0x1.437eeecd8p48, 0x1.6beecca73p52, 0x1.b02b930689p56, 0x1.0e1b3be415ap61,
+    0x1.6283be9b5c62p65, 0x1.e77526159f06cp69, 0x1.5e5c335f8a4cep74,
+    0x1.06c52687a7b9ap79, 0x1.9a940c33f6121p83, 0x1.4d9849ea37eebp88,
+    0x1.19787e5d9f316p93, 0x1.ec92dd23d6967p97, 0x1.be6518687a785p102,
+    0x1.a27ec6e1f2d0dp107, 0x1.956ad0aae33a4p112, 0x1.956ad0aae33a4p117,
+    0x1.a21627303a541p122, 0x1.bc3789a33df96p127, 0x1.e5dcbe8a8bc8cp132,
+    0x1.114c2b2deea0fp138, 0x1.3c0011ed1bea1p143, 0x1.774015499125fp148,
+    0x1.c95619f1a8e64p153, 0x1.1dd5d037098fep159, 0x1.6e39f2c684406p164,
+    0x1.e0ac0ea48d948p169, 0x1.42f399d68f1fcp175, 0x1.bc0ef38704cbbp180,
+    0x1.383a833aef5f3p186, 0x1.c0d41ca4b818ep191, 0x1.499bc508f7324p197,
+    0x1.ee69a78d72cb6p202, 0x1.7a88e4484be3bp208, 0x1.27baf2587b49ep214,
+    0x1.d751f23d047dcp219, 0x1.7ef294d193a63p225, 0x1.3d20e33d8e45ap231,
+    0x1.0b93bfbbf00acp237, 0x1.cbe5f18b04928p242, 0x1.92693359a4003p248,
+    0x1.6665b1bbd6102p254, 0x1.44cc291239feap260, 0x1.2b6c35dccd76cp266,
+    0x1.18b5727f009f5p272, 0x1.0b8cf1210c97ep278, 0x1.0330899804332p284,
+    0x1.fe478ee34844ap289, 0x1.fe478ee34844ap295, 0x1.0320568f6ab2ep302,
+    0x1.0b395943e6087p308, 0x1.17c0097314d0dp314, 0x1.293c0a0a461dep320,
+    0x1.4074bad313983p326, 0x1.5e7fac56dd6e8p332, 0x1.84d5a3305da69p338,
+    0x1.b5705796695b6p344, 0x1.f2f423e7902c4p350, 0x1.207524c1df599p357,
+    0x1.5209471331bdp363, 0x1.916b0466cb107p369, 0x1.e2f4c14bac4fcp375,
+    0x1.264d25ca1d009p382, 0x1.6b473aa57bcccp388, 0x1.c619094edabffp394,
+    0x1.1f5bd7e3e66d7p401, 0x1.702dac9bff3c4p407, 0x1.dd7b3bda4f022p413,
+    0x1.3958df4743d96p420, 0x1.a02a088aa61cbp426, 0x1.179c3dbd279b5p433,
+    0x1.7c1863ed21d72p439, 0x1.0550c4b30743ep446, 0x1.6b645188f61a6p452,
+    0x1.ff0512a89a152p458, 0x1.6b4d9b43dd8bp465, 0x1.051fc798c73bfp472,
+    0x1.7b722e0a01831p478, 0x1.16a7d9cf591c4p485, 0x1.9da1274fc845fp491,
+    0x1.3638dd7bd6347p498, 0x1.d62e2fafb0a78p504, 0x1.67fb5c8283404p511,
+    0x1.166c698cf183bp518, 0x1.b30964ec395dcp524, 0x1.574569a26544p531,
+    0x1.118b502d68b23p538, 0x1.b83c3509147ecp544, 0x1.65b0eb1760a7p551,
+    0x1.256b20d92d49p558, 0x1.e5f96e67b300ep564, 0x1.963e824aafa2cp571,
+    0x1.56c4bdef04315p578, 0x1.23e389bd8992p585, 0x1.f5af14bdc472fp591,
+    0x1.b30dd3fc905bap598, 0x1.7cac197cfe503p605, 0x1.500fee805882dp612,
+    0x1.2b4e306a4ed48p619, 0x1.0ce83f7f82d2fp626, 0x1.e764f3171d1e4p632,
+    0x1.bd824633209dbp639, 0x1.9ab418b722116p646, 0x1.7dd36efa41ac2p653,
+    0x1.65f6380a9d916p660, 0x1.5262c0fa08f37p667, 0x1.42861fee5088p674,
+    0x1.35ece2af0162bp681, 0x1.2c3d7b998957ap688, 0x1.25340ab3f01f9p695,
+    0x1.209f3a89205f1p702, 0x1.1e5dfc140e1e5p709, 0x1.1e5dfc140e1e5p716,
+    0x1.209ab80c363a9p723, 0x1.251d22ec67138p730, 0x1.2bfbd1bdf17dfp737,
+    0x1.355bb04be109ep744, 0x1.4171452ed7d44p751, 0x1.5082946d09f23p758,
+    0x1.62e9b88b007d7p765, 0x1.79185413b0855p772, 0x1.939c09fd12eebp779,
+    0x1.b3243ac4d8695p786, 0x1.d88957d1c3026p793, 0x1.026b1c06b6a55p801,
+    0x1.1ca9fcdf65321p808, 0x1.3bcc9487d4439p815, 0x1.60ce8defbf238p822,
+    0x1.8ce85fadb707ep829, 0x1.c19f3c62c956fp836, 0x1.006cd07056d39p844,
+    0x1.267cf76103b7p851, 0x1.54807e082c4b9p858, 0x1.8c5d92b5839p865,
+    0x1.d07da7ecb62ccp872, 0x1.11fa1e0c9f746p880, 0x1.455903aefd5a3p887,
+    0x1.84e466672ad5dp894, 0x1.d3e2cb341f894p901, 0x1.1b4a51088f182p909,
+    0x1.594292c26e656p916, 0x1.a77ba8027b686p923, 0x1.055e51b1882a7p931,
+    0x1.44ab297a8724bp938, 0x1.95d5f3d928edep945, 0x1.fe771cb7257b3p952,
+    0x1.4307602be5b7fp960, 0x1.9b5b6477e6884p967, 0x1.07868c5ccfaf4p975,
+    0x1.53b370efa3b7fp982, 0x1.b88cb676c8529p989, 0x1.1f63cb077cadep997,
+    0x1.7932fa79d3a43p1004, 0x1.f2054eb4d96ecp1011, 0x1.4ab7864418639p1019};
+
+long double s21_factorial(int n) {
+    if (n < 0) {
+        errno = EDOM;
+        return s21_NAN;
+    }
+    return n <= 170 ? s21_fact_tab[n] : s21_INF;
+}
+
+/* Lanczos approximation with g = 7 and 9 terms (Godfrey's coefficients) */
+#define s21_LANCZOS_N 9
+#define s21_LANCZOS_G 7.0L
+static const long double s21_lanczos[s21_LANCZOS_N] = {
+    0.99999999999980993227684700473478L,
+    676.520368121885098567009190444019L,
+    -1259.13921672240287047156078755283L,
+    771.3234287776530788486528258894L,
+    -176.61502916214059906584551354L,
+    12.507343278686904814458936853L,
+    -0.13857109526572011689554707L,
+    9.984369578019570859563e-6L,
+    1.50563273514931155834e-7L};
+
+static const long double s21_ln_sqrt_2pi_l =
+    0.918938533204672741780329736405617640L;
+static const long double s21_pi_l = 3.141592653589793238462643383279502884L;
+static const long double s21_ln_pi_l = 1.144729885849400174143427351353058712L;
+
+/*
+ * Taylor series of log(gamma(2 + w)) about w = 0, psi^(k-1)(2) / k! for
+ * k = 1..32. The coefficients shrink by about half per term, so on
+ * |w| <= 1/2 the first omitted term is below 1e-21.
+ */
+#define s21_LGAMMA2_N 32
+static const long double s21_lgamma2_coef[s21_LGAMMA2_N] = {
+    4.227843350984671393935e-1L, 3.224670334241132182362e-1L,
+    -6.735230105319809513325e-2L, 2.058080842778454787900e-2L,
+    -7.385551028673985266273e-3L, 2.890510330741523285753e-3L,
+    -1.192753911703260977114e-3L, 5.096695247430424223357e-4L,
+    -2.231547584535793797614e-4L, 9.945751278180853371460e-5L,
+    -4.492623673813314170021e-5L, 2.050721277567069155317e-5L,
+    -9.439488275268395903987e-6L, 4.374866789907487804182e-6L,
+    -2.039215753801366236782e-6L, 9.551412130407419832857e-7L,
+    -4.492469198764566043294e-7L, 2.120718480555466586923e-7L,
+    -1.004322482396809960872e-7L, 4.769810169363980565760e-8L,
+    -2.271109460894316491032e-8L, 1.083865921489695409107e-8L,
+    -5.183475041970046655121e-9L, 2.483674543802478317185e-9L,
+    -1.192140140586091207443e-9L, 5.731367241678862013330e-10L,
+    -2.759522885124233145178e-10L, 1.330476437424448948150e-10L,
+    -6.422964563838100022082e-11L, 3.104424774732227276239e-11L,
+    -1.502138408075414217093e-11L, 7.275974480239079662505e-12L};
+
+/*
+ * The four zeros of lgamma in (-4, -2), as hi + lo and the half width of
+ * the window around each, a tenth of the distance to the nearest pole.
+ * Inside it lgamma is its Taylor series about the zero, with the
+ * coefficients psi^(k-1)(x0) / k!, k = 1..20, in s21_lgamma_root_coef.
+ */
+#define s21_LGAMMA_ROOTS 4
+static const double s21_lgamma_root[s21_LGAMMA_ROOTS][3] = {
+    {-0x1.3a7fc9600f86cp+1, -0x1.55f64f98af8dp-55, 0.0457},
+    {-0x1.5fb410a1bd901p+1, 0x1.a19a96d2e6f85p-54, 0.0252},
+    {-0x1.9260dbc9e59afp+1, -0x1.f717cd335a7b3p-53, 0.0144},
+    {-0x1.fa471547c2fe5p+1, -0x1.70d4561291237p-56, 0.00447},
+};
+
+static const long double s21_lgamma_root_coef[s21_LGAMMA_ROOTS][20] = {
+    /* x0 = -2.4570 */
+    {1.515603448021657321637L, 4.858320951633996120494L,
+     1.411291143077979950553L, 8.721782583815346217951L,
+     5.800414566599872471734L, 2.482494212189407109435e+1L,
+     2.403882306229295428854e+1L, 8.222915682704253242636e+1L,
+     1.006481235455115911968e+2L, 2.964364135076131956819e+2L,
+     4.251798456843821169995e+2L, 1.130457858177512988623e+3L,
+     1.811205418801871261982e+3L, 4.487218453188998311453e+3L,
+     7.776158102344246472940e+3L, 1.834717069997702525608e+4L,
+     3.363045705579433917838e+4L, 7.672103602398428872955e+4L,
+     1.464319982921339346753e+5L, 3.264337022215632974639e+5L},
+    /* x0 = -2.7477 */
+    {-1.914350185611598816495L, 9.575189475709666670650L,
+     -2.009513491684260258246e+1L, 6.262728271351371319293e+1L,
+     -1.947661553034462166479e+2L, 6.469059997129282757213e+2L,
+     -2.193112776480623742906e+3L, 7.610397986658328729439e+3L,
+     -2.680457842061810870993e+4L, 9.561745164334970316442e+4L,
+     -3.444975934348328916728e+5L, 1.251567446525100201878e+6L,
+     -4.578716594581717481629e+6L, 1.685048427069736617663e+7L,
+     -6.233068483240741477259e+7L, 2.315933598035293759903e+8L,
+     -8.638732529293209521983e+8L, 3.233548126076056580715e+9L,
+     -1.214090640086433791051e+10L, 4.571172354179555115272e+10L},
+    /* x0 = -3.1436 */
+    {7.781884658131350872140L, 2.583133837238795893575e+1L,
+     1.122689862971760025783e+2L, 5.888907422380013467337e+2L,
+     3.277193785495341744982e+3L, 1.902306198435635837184e+4L,
+     1.135596642371351622398e+5L, 6.920496022897746119868e+5L,
+     4.284377443645979621552e+6L, 2.685552505557588804935e+7L,
+     1.700373458217431236491e+8L, 1.085573221570005082358e+9L,
+     6.979115396671345966273e+9L, 4.513558335751527864039e+10L,
+     2.933993858823304505171e+11L, 1.915727973453940358529e+12L,
+     1.255764686639060185076e+13L, 8.260152137622804505913e+13L,
+     5.450173333096822439767e+14L, 3.606095996440261253053e+15L},
+    /* x0 = -3.9553 */
+    {-2.072506084580370567830e+1L, 2.517146825868894001461e+2L,
+     -3.730604715680612510742e+3L, 6.258808191876606055937e+4L,
+     -1.119991501665522135394e+6L, 2.087711472650332924809e+7L,
+     -4.002769981874636580544e+8L, 7.834398183738318402235e+9L,
+     -1.557722424165721681402e+11L, 3.135952925293292291580e+12L,
+     -6.376961618226690388003e+13L, 1.307561713653824542590e+15L,
+     -2.699833879304111122526e+16L, 5.607758637305036865439e+17L,
+     -1.170746971596382336793e+19L, 2.455111795885670332161e+20L,
+     -5.168675744572264565956e+21L, 1.091924617838231054081e+23L,
+     -2.313920933460008349806e+24L, 4.917100374827080041530e+25L},
+};
+
+/* log of a positive long double; the part lost when rounding to double
+ * is added back to first order */
+static long double s21_log_l(long double t) {
+    double td = (double)t;
+    return s21_log_hp(td) + (t - td) / td;
+}
+
+/*
+ * Stirling series terms B(2k) / (2k (2k - 1)), k = 1..8. From x = 10 on
+ * the first omitted term is below 2e-18.
+ */
+static const long double s21_stirling[8] = {
+    1.0L / 12,   -1.0L / 360,      1.0L / 1260, -1.0L / 1680,
+    1.0L / 1188, -691.0L / 360360, 1.0L / 156,  -3617.0L / 122400};
+
+/*
+ * log(gamma(x)) for x >= 1/2. Up to 5/2 it is the series about 2, taking
+ * log(gamma(1 + w)) = log(gamma(2 + w)) - log(1 + w) below 3/2, which
+ * keeps the relative error small at the zeros 1 and 2. Up to 10 the
+ * Lanczos form (x - 1/2) log(t) - t + log(sqrt(2 pi) A(x)), with
+ * t = x + g - 1/2 and A the Lanczos sum; its error grows with x, so
+ * larger arguments take the Stirling series instead.
+ */
+static long double s21_lgamma_pos(long double x) {
+    long double res;
+    if (x <= 2.5L) {
+        long double w = x < 1.5L ? x - 1 : x - 2, sum = 0;
+        for (int k = s21_LGAMMA2_N - 1; k >= 0; k--) {
+            sum = sum * w + s21_lgamma2_coef[k];
+        }
+        res = x < 1.5L ? sum * w - s21_log_l(x) : sum * w;
+    } else if (x < 10) {
+        long double z = x - 1, a = s21_lanczos[0];
+        for (int k = 1; k < s21_LANCZOS_N; k++) {
+            a += s21_lanczos[k] / (z + k);
+        }
+        long double t = z + s21_LANCZOS_G + 0.5L;
+        res = (z + 0.5L) * s21_log_l(t) - t + s21_ln_sqrt_2pi_l +
+              s21_log_l(a);
+    } else {
+        long double r = 1 / x, r2 = r * r, sum = 0;
+        for (int k = 7; k >= 0; k--) sum = sum * r2 + s21_stirling[k];
+        res = (x - 0.5L) * s21_log_l(x) - x + s21_ln_sqrt_2pi_l + sum * r;
+    }
+    return res;
+}
+
+/*
+ * log|gamma(x)| for -4 < x < 0, where reflection would subtract values
+ * near 1 that are only accurate to double. The recurrence shifts x up to
+ * [1/2, 3/2) instead, with every term exact to long double, and within
+ * the window around a zero the Taylor series about it takes over.
+ */
+static long double s21_lgamma_neg(double x) {
+    for (int i = 0; i < s21_LGAMMA_ROOTS; i++) {
+        const double *root = s21_lgamma_root[i];
+        long double d = ((long double)x - root[0]) - root[1];
+        if (d < root[2] && d > -root[2]) {
+            const long double *c = s21_lgamma_root_coef[i];
+            long double sum = 0;
+            for (int k = 19; k >= 0; k--) sum = sum * d + c[k];
+            return sum * d;
+        }
+    }
+    long double y = x, prod = 1;
+    while (y < 0.5L) {
+        prod *= y;
+        y += 1;
+    }
+    return s21_lgamma_pos(y) - s21_log_l(prod < 0 ? -prod : prod);
+}
+
+/* gamma(x) for x >= 1/2; integers up to 171 come from the table */
+static long double s21_tgamma_pos(long double x) {
+    if (x <= 171 && x == (long long)x) return s21_fact_tab[(int)x - 1];
+    return s21_exp_hp(s21_lgamma_pos(x));
+}
+
+/*
+ * Below 1 gamma(x) = gamma(x + 1) / x for positive x and the
+ * reflection pi / (sin(pi x) gamma(1 - x)) for negative x. Negative
+ * integers, -inf included, are a domain error. The result is rounded to
+ * double so overflow and underflow match the double range.
+ */
+long double s21_tgamma(double x) {
+    long double res;
+    if (is_nan(x) || x == s21_INF) {
+        res = x;
+    } else if (x == 0) {
+        errno = ERANGE;
+        res = s21_copysign(s21_INF, x);
+    } else if (x < 0 && x == s21_trunc_d(x)) {
+        errno = EDOM;
+        res = s21_NAN;
+    } else if (x >= 1) {
+        res = s21_tgamma_pos(x);
+    } else if (x > 0) {
+        res = s21_tgamma_pos(1.0L + x) / x;
+    } else {
+        res = s21_pi_l / (s21_sinpi(x) * s21_tgamma_pos(1.0L - x));
+    }
+    return (double)res;
+}
+
+/*
+ * Same split as s21_tgamma, in logarithms:
+ * log|gamma(x)| = log(pi) - log|sin(pi x)| - log(gamma(1 - x)) for
+ * x <= -4. Above that, where lgamma has its zeros, s21_lgamma_neg.
+ */
+long double s21_lgamma(double x) {
+    long double res;
+    if (is_nan(x) || is_inf(x)) {
+        res = s21_fabs(x);
+    } else if (x <= 0 && x == s21_trunc_d(x)) {
+        errno = ERANGE;
+        res = s21_INF;
+    } else if (x <= 171 && x == s21_trunc_d(x)) {
+        res = s21_log_hp(s21_fact_tab[(int)x - 1]);
+    } else if (x >= 1) {
+        res = s21_lgamma_pos(x);
+    } else if (x > 0) {
+        res = s21_lgamma_pos(1.0L + x) - s21_log_hp(x);
+    } else if (x > -4) {
+        res = s21_lgamma_neg(x);
+    } else {
+        res = s21_ln_pi_l - s21_log_hp(s21_fabs(s21_sinpi(x))) -
+              s21_lgamma_pos(1.0L - x);
+    }
+    return (double)res;
+}
+
+void s21_tgamma_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_tgamma(in[i]);
+}
+
+void s21_lgamma_n(const double *in, double *out, size_t n) {
+    for (size_t i = 0; i < n; i++) out[i] = s21_lgamma(in[i]);
+}
+
+/*
+ * erf(x) = x P(x^2) on |x| < 0.5, a minimax fit made with tools/remez
+ * (erf 0 0.5 17 --odd --rel), relative error 1.4e-17.
+ */
+static const double s21_erf_coef[9] = {
+    0x1.20dd750429b6dp+0,  -0x1.812746b0379b3p-2, 0x1.ce2f21a03d65dp-4,
+    -0x1.b82ce30f1e4cp-6,  0x1.565bcbf5dc251p-8,  -0x1.c02d4ea72226ap-11,
+    0x1.f98d96918e86p-14,  -0x1.f222b2de60da7p-17, 0x1.8b3a280c876f4p-20};
+
+/*
+ * erfcx(x) = erfc(x) e^(x^2) on [0.5, 32), cut into eight segments per
+ * binade. Row 8 e + m covers the x in [2^(e - 1), 2^e) whose top three
+ * mantissa bits are m, and holds the powers 0..10 of x - center, where
+ * center is the middle of the segment. Each row comes from tools/remez
+ * (erfcx LO HI 10 --rel --center C --cheb); the relative error is at
+ * most 1.4e-16, the rounding of the coefficients.
+ */
+#define s21_ERFCX_SEGS 48
+static const double s21_erfcx_tab[s21_ERFCX_SEGS][11] = {
+    /* [0.5, 0.5625) */
+    {0x1.3334ea3613dep-1, -0x1.f6a5625dbca39p-2, 0x1.5b61f82a5b859p-2,
+     -0x1.a821c8b450099p-3, 0x1.d571fdb4a5112p-4, -0x1.df18cee8c7c26p-5,
+     0x1.c83f41d9b8eb5p-6, -0x1.9908eb030390cp-7, 0x1.5a756f02b74abp-8,
+     -0x1.1ba523874d91bp-9, 0x1.1abb0f19bdaabp-7},
+    /* [0.5625, 0.625) */
+    {0x1.242708751d9a7p-1, -0x1.cd991ffa808c8p-2, 0x1.363b25ed7ee05p-2,
+     -0x1.71dd574751382p-3, 0x1.90dae00933805p-4, -0x1.9160948167ebcp-5,
+     0x1.77982cc6adb91p-6, -0x1.4b47189f6648fp-7, 0x1.16f6b316a736fp-8,
+     -0x1.c9f9e4fd9446p-10, -0x1.4422d427766afp-7},
+    /* [0.625, 0.6875) */
+    {0x1.164fc6284ab1ep-1, -0x1.a8e46be6e2c85p-2, 0x1.15c9a581108e6p-2,
+     -0x1.43757462eacdcp-3, 0x1.574e36a20ef2ap-4, -0x1.514c770abc2fap-5,
+     0x1.362c0856446f8p-6, -0x1.0d2e07b989486p-7, 0x1.c0140b7959d31p-9,
+     -0x1.31c71a8aaa74cp-10, -0x1.8a06b8850bb5p-7},
+    /* [0.6875, 0.75) */
+    {0x1.098ea367ecbccp-1, -0x1.87fbbe45de3c9p-2, 0x1.f2c0ac1b437d1p-3,
+     -0x1.1ba8ab3ac25d3p-3, 0x1.26df7108fc3eap-4, -0x1.1c4d6435a13abp-5,
+     0x1.00ef7d5e24987p-6, -0x1.b6c6d59f9634bp-8, 0x1.6564388f9034dp-9,
+     -0x1.158d60dfa5ab9p-10, -0x1.43aeb3c01d1fap-8},
+    /* [0.75, 0.8125) */
+    {0x1.fb8e558b14d9p-2, -0x1.6a676e6756483p-2, 0x1.c0db0e94b2e17p-3,
+     -0x1.f2da4c8e001c9p-4, 0x1.fbfb915a596dep-5, -0x1.e0acd973249f2p-6,
+     0x1.aaf56bf6a2a5ep-7, -0x1.66b8ad96544e1p-8, 0x1.1e4a657e5b7e7p-9,
+     -0x1.e5bc8ec48fcf9p-11, 0x1.32e36142f2309p-9},
+    /* [0.8125, 0.875) */
+    {0x1.e5c0be6e7d145p-2, -0x1.4fc092b633c9p-2, 0x1.94ec854982c49p-3,
+     -0x1.b7ccc69dd6aa8p-4, 0x1.b6c442fe1f48p-5, -0x1.97832a412c05dp-6,
+     0x1.63cbdd4b6fc9ap-7, -0x1.262cf353303bdp-8, 0x1.d0774399a0958p-10,
+     -0x1.7c14d2a4f5e63p-11, -0x1.2108484e950aep-10},
+    /* [0.875, 0.9375) */
+    {0x1.d188819e7fef8p-2, -0x1.37ae69215ef93p-2, 0x1.6e24e4b083bd1p-3,
+     -0x1.84b9d9590a773p-4, 0x1.7c015c67d6ffbp-5, -0x1.5a752ba666599p-6,
+     0x1.295b1278020c9p-7, -0x1.e3f93509341bp-9, 0x1.7687481e4f2ecp-10,
+     -0x1.95643e6411d54p-12, 0x1.6cd3d2647cef6p-11},
+    /* [0.9375, 1.0) */
+    {0x1.bebec8c623082p-2, -0x1.21e42f10c2fb9p-2, 0x1.4bd3765bcc472p-3,
+     -0x1.586f59f61f7fcp-4, 0x1.49fb0d9204f6dp-5, -0x1.275c658aa0663p-6,
+     0x1.f2707e7f8c2c7p-8, -0x1.8f2b6a22146f7p-9, 0x1.36b5c9bb19932p-10,
+     -0x1.0033463345d22p-11, -0x1.20e4df3548bd8p-7},
+    /* [1.0, 1.125) */
+    {0x1.a4f550c5f1a99p-2, -0x1.04ec886c0552fp-2, 0x1.1f73ffa658038p-3,
+     -0x1.20926c49bc487p-4, 0x1.0c4c6c3e461cp-5, -0x1.d352a27f7df01p-7,
+     0x1.80714443d529p-8, -0x1.2cabfd2f3ad13p-9, 0x1.c15fe1d24b245p-11,
+     -0x1.426d8737a0ed4p-12, 0x1.e2b10f561e7f9p-14},
+    /* [1.125, 1.25) */
+    {0x1.8674923c605e1p-2, -0x1.c841f18283f7ap-3, 0x1.de35ab5b880afp-4,
+     -0x1.cb858a0b1e039p-5, 0x1.9abcc2c9ff4dbp-6, -0x1.5908bd6a7b12fp-7,
+     0x1.127f6c8541175p-8, -0x1.a01de16fb7f9p-10, 0x1.2df6de3bc1b0ap-11,
+     -0x1.a57d2da37e658p-13, 0x1.fde0cb3e3a693p-15},
+    /* [1.25, 1.375) */
+    {0x1.6bb376a9390cdp-2, -0x1.917d7928e2332p-3, 0x1.90e47c99926cp-4,
+     -0x1.711413b59a9d6p-5, 0x1.3d5e9f54eb462p-6, -0x1.014991db8d16ep-7,
+     0x1.8c10e70bcc81cp-9, -0x1.2308f52fa2ce3p-10, 0x1.9a3a671fe9d65p-12,
+     -0x1.171ed4a6af847p-13, 0x1.341ead123bdaep-15},
+    /* [1.375, 1.5) */
+    {0x1.5416a05961e1cp-2, -0x1.63698e1f5ae48p-3, 0x1.528b08cb6235cp-4,
+     -0x1.2ae454cdcb5e1p-5, 0x1.eedbaf5e0832bp-7, -0x1.835e05b6a22fcp-8,
+     0x1.209577d6ae8dap-9, -0x1.9b4ee7294cd7ap-11, 0x1.1999dd5951747p-12,
+     -0x1.743a921f21555p-14, 0x1.805316ca02a4cp-16},
+    /* [1.5, 1.625) */
+    {0x1.3f20d017f353p-2, -0x1.3c5e938b9cefcp-3, 0x1.1fdbb34b82df1p-4,
+     -0x1.e7e4fd2df84e4p-6, 0x1.851901962f7cfp-7, -0x1.264253254481ep-8,
+     0x1.a88dd753da044p-10, -0x1.258637279042p-11, 0x1.867a83b10b619p-13,
+     -0x1.f8cf2432678fdp-15, 0x1.2932954ac94e2p-16},
+    /* [1.625, 1.75) */
+    {0x1.2c6c3d2ac6111p-2, -0x1.1b110b4094c34p-3, 0x1.ecaedd6244636p-5,
+     -0x1.9126c9e5ff9p-6, 0x1.346c46105395p-7, -0x1.c2f16282cacb6p-9,
+     0x1.3b2683c3d4db7p-10, -0x1.a6ef8aff320bfp-12, 0x1.11575c0dd5e6ep-13,
+     -0x1.56ff80b378b8p-15, 0x1.360283967c4e2p-16},
+    /* [1.75, 1.875) */
+    {0x1.1ba58e2518db3p-2, -0x1.fcf6c328b302ep-4, 0x1.a82dedb53defdp-5,
+     -0x1.4c2309f688064p-6, 0x1.ecb8b2b724de1p-8, -0x1.5c644fe8c1afep-9,
+     0x1.d7fa1dd19b151p-11, -0x1.337e08402e59fp-12, 0x1.8290b0a82e1d6p-14,
+     -0x1.d3f4d3b72a11ep-16, 0x1.3a110f3386cdbp-17},
+    /* [1.875, 2.0) */
+    {0x1.0c8803dfa92b2p-2, -0x1.cb9b1437dd505p-4, 0x1.6f4730a4cfc0cp-5,
+     -0x1.14d04d95e01a7p-6, 0x1.8c7595eec6f15p-8, -0x1.0f4ab64837709p-9,
+     0x1.646332defe6b2p-11, -0x1.c30c09fd3aab8p-13, 0x1.140525a76163dp-14,
+     -0x1.4750712ba116ep-16, 0x1.3e8fc9c9282f3p-20},
+    /* [2.0, 2.25) */
+    {0x1.f0fd28fdc20abp-3, -0x1.8d6f73d5aa121p-4, 0x1.2adaf7aaf55eep-5,
+     -0x1.aa2443aac5d18p-7, 0x1.21decee0e0095p-8, -0x1.7a181936800e9p-10,
+     0x1.dab55e16edb1p-12, -0x1.1fc8437904d62p-13, 0x1.51ded8625f18dp-15,
+     -0x1.823eda4eca4ffp-17, 0x1.ae2ea46d018dcp-19},
+    /* [2.25, 2.5) */
+    {0x1.c3987d04d0b98p-3, -0x1.4baeac94dc8b2p-4, 0x1.cdc880a056a12p-6,
+     -0x1.32a8abc8da8bp-7, 0x1.8680d2875c7f8p-9, -0x1.deb45eac2e2bep-11,
+     0x1.1b649b392879p-12, -0x1.44f8a2045e3afp-14, 0x1.69c4acec667cep-16,
+     -0x1.88dccafac9d3ap-18, 0x1.9c21f720c370ep-20},
+    /* [2.5, 2.75) */
+    {0x1.9d7738e1f4db7p-3, -0x1.18737afe106cep-4, 0x1.6afd3ba3fa634p-6,
+     -0x1.c28dd3c4d5b5dp-8, 0x1.0d40a2ab43195p-9, -0x1.36e994159ad54p-11,
+     0x1.5bd1dceb27132p-13, -0x1.79da79155a2bep-15, 0x1.8f6aea532ba07p-17,
+     -0x1.9ca612a0b870dp-19, 0x1.9c3feda92c55p-21},
+    /* [2.75, 3.0) */
+    {0x1.7d0a5e9dd571p-3, -0x1.dfc0205709b2cp-5, 0x1.21c23afa33c5p-6,
+     -0x1.512f92fca637bp-8, 0x1.7b404aa4cc616p-10, -0x1.9d6f2232511f1p-12,
+     0x1.b5d78c11e3d95p-14, -0x1.c35c108f36f05p-16, 0x1.c5afef9c9afbep-18,
+     -0x1.be8c29521a597p-20, 0x1.b40512fedfb06p-22},
+    /* [3.0, 3.25) */
+    {0x1.612a8125451bdp-3, -0x1.9e8803e177224p-5, 0x1.d503e1d20090ep-7,
+     -0x1.009a9272238c9p-8, 0x1.104973feac14p-10, -0x1.18d4654bc734cp-12,
+     0x1.1a12c42e7d219p-14, -0x1.1463346b65999p-16, 0x1.0896863f09d41p-18,
+     -0x1.f0a9c0193c583p-21, 0x1.c1775d3ece985p-23},
+    /* [3.25, 3.5) */
+    {0x1.48f8f10299b71p-3, -0x1.696d353f008b5p-5, 0x1.804cc15714193p-7,
+     -0x1.8c84c13afbb76p-9, 0x1.8de5f26a5a5dbp-11, -0x1.851184706756p-13,
+     0x1.7350e5bb8daddp-15, -0x1.5a610efc21788p-17, 0x1.3c2fda1eeb875p-19,
+     -0x1.1b8af5fd6354bp-21, 0x1.0d44db99f8b4dp-23},
+    /* [3.5, 3.75) */
+    {0x1.33cb19179d7f6p-3, -0x1.3dacc8d85f6c4p-5, 0x1.3e68313870551p-7,
+     -0x1.36992d37bd075p-9, 0x1.276b01ef47c91p-11, -0x1.1267afb80fe4ap-13,
+     0x1.f28b1f774530dp-16, -0x1.bb741ce982a33p-18, 0x1.829b7d1463f81p-20,
+     -0x1.4a695551f169p-22, 0x1.2a40150e1fcdap-24},
+    /* [3.75, 4.0) */
+    {0x1.211c625924e34p-3, -0x1.193eb7b9bf564p-5, 0x1.0a7a05d338785p-7,
+     -0x1.ecb581c2b86bap-10, 0x1.bd21af8ef2282p-12, -0x1.89859798ee787p-14,
+     0x1.54d6be70355bep-16, -0x1.21871719a1fe8p-18, 0x1.e30d3a7052cebp-21,
+     -0x1.8be9d477107fap-23, 0x1.efc2af7994d86p-26},
+    /* [4.0, 4.5) */
+    {0x1.08e62ce8c89adp-3, -0x1.da39533524979p-6, 0x1.9ef71691a5551p-8,
+     -0x1.6373226ed3f7cp-10, 0x1.2a660fdea0678p-12, -0x1.eb88e1692db3ap-15,
+     0x1.8d8e5a5a7583p-17, -0x1.3c064f6925c4fp-19, 0x1.ee3071838327p-22,
+     -0x1.7ea6856c84187p-24, 0x1.22803263af97dp-26},
+    /* [4.5, 5.0) */
+    {0x1.dc603a3e77e9bp-4, -0x1.81149bc4a104ep-6, 0x1.317c144f8b407p-8,
+     -0x1.dc1af8839b4efp-11, 0x1.6cc10c1638d41p-13, -0x1.12f174681958ep-15,
+     0x1.9818c055263c9p-18, -0x1.2a618ec19a0fp-20, 0x1.ae1fb58f58e02p-23,
+     -0x1.335c0c05d01cdp-25, 0x1.ae5cdfff55e62p-28},
+    /* [5.0, 5.5) */
+    {0x1.b096face146fep-4, -0x1.3e981b3b13591p-6, 0x1.cdeae21161602p-9,
+     -0x1.49d492a39ba71p-11, 0x1.d03e19aa38672p-14, -0x1.4230e3ef7687p-16,
+     0x1.b93f467cccd09p-19, -0x1.2a42b6dea58acp-21, 0x1.8e3854f3a167fp-24,
+     -0x1.07d794604939bp-26, 0x1.56bfdb4e38b34p-29},
+    /* [5.5, 6.0) */
+    {0x1.8c14049cd551ep-4, -0x1.0bc46cdc18fe7p-6, 0x1.6535040e2c88ap-9,
+     -0x1.d662fda6d1719p-12, 0x1.31dddbe409fbdp-14, -0x1.8900e0dfb529ap-17,
+     0x1.f31a347c81821p-20, -0x1.395b5383271a7p-22, 0x1.852b5e20449b9p-25,
+     -0x1.e047b1d01c66cp-28, 0x1.28576526736f3p-30},
+    /* [6.0, 6.5) */
+    {0x1.6d2f811bf7397p-4, -0x1.c82c132848f68p-7, 0x1.19a2448fc71efp-9,
+     -0x1.57e0ab4d7b988p-12, 0x1.9f57d767b8962p-15, -0x1.f067808ad1c53p-18,
+     0x1.259fcb062bc1p-20, -0x1.57ebae50bba72p-23, 0x1.8ef623f12afd6p-26,
+     -0x1.cc14f79eb4394p-29, 0x1.055b71c4dfec9p-31},
+    /* [6.5, 7.0) */
+    {0x1.52b80d463c47p-4, -0x1.8914e8736d77cp-7, 0x1.c39a4935fa7d9p-10,
+     -0x1.00e4e3d2d96b4p-12, 0x1.21808c224ed79p-15, -0x1.433e28860154p-18,
+     0x1.65acda79c7798p-21, -0x1.884f2576502fcp-24, 0x1.aa7db76492b58p-27,
+     -0x1.cd32f577c203bp-30, 0x1.126a1f22e1123p-32},
+    /* [7.0, 7.5) */
+    {0x1.3bcc59a28358cp-4, -0x1.5621e47157304p-7, 0x1.6f68a6f3153f5p-10,
+     -0x1.872cdb8202814p-13, 0x1.9d0000a850218p-16, -0x1.b07c4a47ab9efp-19,
+     0x1.c147c8318abaep-22, -0x1.cf17e3b8e5fd6p-25, 0x1.d99d122f8151fp-28,
+     -0x1.e016e27648c12p-31, 0x1.fc65461db3e6dp-34},
+    /* [7.5, 8.0) */
+    {0x1.27c2b4d2f8988p-4, -0x1.2c6aebe4718c2p-7, 0x1.2ec8136aa6292p-10,
+     -0x1.2ed983856cd5ep-13, 0x1.2cab802d8835dp-16, -0x1.285655d1e8213p-19,
+     0x1.21fd0c1445ccfp-22, -0x1.19cbf8557983dp-25, 0x1.1022c781ab16ap-28,
+     -0x1.0535e8a5a86b3p-31, 0x1.694faeccd8514p-35},
+    /* [8.0, 9.0) */
+    {0x1.0e078051f491dp-4, -0x1.f57cad15dbe58p-8, 0x1.cea22f2be0754p-11,
+     -0x1.a80f2934c496ep-14, 0x1.82426c74a837dp-17, -0x1.5da899a35a4abp-20,
+     0x1.3a9b8306fd60dp-23, -0x1.19606cfaf2081p-26, 0x1.f45e1bb78a52bp-30,
+     -0x1.be04c7910902ap-33, 0x1.89093efc0612fp-36},
+    /* [9.0, 10.0) */
+    {0x1.e3db9bbbefc9ep-5, -0x1.93108c9356f3cp-8, 0x1.4dfd333e223f1p-11,
+     -0x1.134ff442561fp-14, 0x1.c3904bd442d26p-18, -0x1.7074a6296e9f2p-21,
+     0x1.2b25eafd21addp-24, -0x1.e35d996882cbp-28, 0x1.84a3f043d04e5p-31,
+     -0x1.39155e5b6d054p-34, 0x1.f12980f4f28ep-38},
+    /* [10.0, 11.0) */
+    {0x1.b634a500659c3p-5, -0x1.4ae8bbe708549p-8, 0x1.f197309556adcp-12,
+     -0x1.74815702722c5p-15, 0x1.15adcc43420f8p-18, -0x1.9c3efc0c35092p-22,
+     0x1.30be80fe560ecp-25, -0x1.c0b32b23de68bp-29, 0x1.4902db419d964p-32,
+     -0x1.e34fb67bc4d75p-36, 0x1.5ccad31b861ep-39},
+    /* [11.0, 12.0) */
+    {0x1.90658c4eb57cbp-5, -0x1.14782b97452f5p-8, 0x1.7c66d2a10486bp-12,
+     -0x1.04c166834dd51p-15, 0x1.6433d10ea9ac1p-19, -0x1.e4dce6d3a3f9cp-23,
+     0x1.48d73fcb2c5e8p-26, -0x1.bc7eec29974cap-30, 0x1.2b57f948e9265p-33,
+     -0x1.941a6fe5906ddp-37, 0x1.175f59850276fp-40},
+    /* [12.0, 13.0) */
+    {0x1.7093453935bbap-5, -0x1.d4cddeef787a8p-9, 0x1.2937870fcdfd2p-12,
+     -0x1.77b3f7978be59p-16, 0x1.d976d0b34aaf8p-20, -0x1.296db5910c9b9p-23,
+     0x1.7490dc4367966p-27, -0x1.d14b0f2a04b6bp-31, 0x1.21b10938d20a2p-34,
+     -0x1.69362199e76c2p-38, 0x1.c24032054743bp-42},
+    /* [13.0, 14.0) */
+    {0x1.556d4dd1f605cp-5, -0x1.9276b60443f77p-9, 0x1.d9243e5cacce8p-13,
+     -0x1.1560775b705b2p-16, 0x1.445d3c97c7d46p-20, -0x1.7a51b077502fp-24,
+     0x1.b81aa15fef8efp-28, -0x1.fea9088fedc4bp-32, 0x1.273fb0393cce6p-35,
+     -0x1.55ea2f0de3101p-39, 0x1.f813250927eadp-43},
+    /* [14.0, 15.0) */
+    {0x1.3dfeb746148ecp-5, -0x1.5d3dd94e2ae29p-9, 0x1.7eaa573db10f4p-13,
+     -0x1.a2517ed713f3cp-17, 0x1.c83e256a302f8p-21, -0x1.f0785db316091p-25,
+     0x1.0d82a4c73ce73p-28, -0x1.23f5816483a59p-32, 0x1.3b67e973cb3a4p-36,
+     -0x1.50fc8b5c19494p-40, 0x1.9f672687120e8p-44},
+    /* [15.0, 16.0) */
+    {0x1.29910a1ff7b0ep-5, -0x1.31e66a6386f9fp-9, 0x1.39d30f8cee98dp-13,
+     -0x1.414ce1ffccb19p-17, 0x1.484a4e9474dedp-21, -0x1.4ec25b38096bdp-25,
+     0x1.54ac8d68c8f72p-29, -0x1.5a01c64c4d4e2p-33, 0x1.5f819fe103c44p-37,
+     -0x1.63b0e56a29e24p-41, 0x1.95ba855300e63p-48},
+    /* [16.0, 18.0) */
+    {0x1.0f67b1bff7645p-5, -0x1.fd20a0cb710b8p-10, 0x1.dcb8a7c6af16dp-14,
+     -0x1.bd9f058f42aebp-18, 0x1.9fd8ef1fc76bp-22, -0x1.836965ea3bd0dp-26,
+     0x1.68515d02cf844p-30, -0x1.4e8d3ca45bf66p-34, 0x1.361af9f3914f2p-38,
+     -0x1.21a1240cbddeap-42, 0x1.0d8e7cd64e33fp-46},
+    /* [18.0, 20.0) */
+    {0x1.e5d6a9f4cc3eap-6, -0x1.98006b41c68f2p-10, 0x1.562a96b075783p-14,
+     -0x1.1e90357c98d96p-18, 0x1.df572c71bdd8p-23, -0x1.905c155e400c3p-27,
+     0x1.4df13cc43779cp-31, -0x1.162a1f2114de2p-35, 0x1.ced4744e90537p-40,
+     -0x1.8347bac516e85p-44, 0x1.3e5e3f5ed8295p-48},
+    /* [20.0, 22.0) */
+    {0x1.b7ad8ef8307ccp-6, -0x1.4e3cc52793c3cp-10, 0x1.fb98687d18009p-15,
+     -0x1.8100c74fdb43fp-19, 0x1.23b1721ead628p-23, -0x1.b9813b30f4eafp-28,
+     0x1.4dc25a75824f6p-32, -0x1.f80d32b1e52a7p-37, 0x1.7c433486a8dbdp-41,
+     -0x1.205526a67ea27p-45, 0x1.a78800edd040dp-50},
+    /* [22.0, 24.0) */
+    {0x1.91853accde052p-6, -0x1.16cb03a88c8f7p-10, 0x1.82cb1527ef78bp-15,
+     -0x1.0c109a760e97cp-19, 0x1.73371e2525dcp-24, -0x1.00ca3b158bd7ap-28,
+     0x1.62f13c7c43dd8p-33, -0x1.ea25da26efdfbp-38, 0x1.51f73bdffae54p-42,
+     -0x1.d5794d2a94565p-47, 0x1.65d9d3ee56cc2p-51},
+    /* [24.0, 26.0) */
+    {0x1.7173c308c43e9p-6, -0x1.d8252a832fb49p-11, 0x1.2d73a48df2e0bp-15,
+     -0x1.80a1dc85d62fp-20, 0x1.ea608ac13d76ap-25, -0x1.3859b201581bp-29,
+     0x1.8d98942de9953p-34, -0x1.f9b46b9cf76a3p-39, 0x1.4156d5cef9ab8p-43,
+     -0x1.9a0569159d711p-48, 0x1.0af8f20766c87p-52},
+    /* [26.0, 28.0) */
+    {0x1.561fcfda08321p-6, -0x1.94ed2196647bdp-11, 0x1.deee0c8da2c98p-16,
+     -0x1.1b0953da1bcf3p-20, 0x1.4e4f0db1a2cc6p-25, -0x1.8a9a070f59ba8p-30,
+     0x1.d17483d130a43p-35, -0x1.12554975193a2p-39, 0x1.421df182423dp-44,
+     -0x1.7bfb3a52891c8p-49, 0x1.bdf674e223b6dp-53},
+    /* [28.0, 30.0) */
+    {0x1.3e8ef95095f56p-6, -0x1.5f18990e83c1bp-11, 0x1.82ba6dba30b5fp-16,
+     -0x1.a9b9a4c0150d9p-21, 0x1.d460d8c3b7e49p-26, -0x1.018036049a075p-30,
+     0x1.1af7a8e8d6b3cp-35, -0x1.36ceb7fd91534p-40, 0x1.54826d9f30fddp-45,
+     -0x1.660fea818cbf3p-50, 0x1.31efc4a80a5bbp-54},
+    /* [30.0, 32.0) */
+    {0x1.2a0744d5828c7p-6, -0x1.3352aa99f62cep-11, 0x1.3cbe417043a1ep-16,
+     -0x1.46488de049431p-21, 0x1.4feffe0f4ff8cp-26, -0x1.59b2e96f1ca3ep-31,
+     0x1.638edb9293173p-36, -0x1.6d84dbfb039ddp-41, 0x1.7ab57825d01dep-46,
+     -0x1.81add1efce81ep-51, -0x1.ac55c01a744f4p-55},
+};
+
+/*
+ * Segment of a in [0.5, 32) from its exponent and top three mantissa
+ * bits; returns the row, clamped so every a reads a valid one, and
+ * stores a - center in *d.
+ */
+static inline int64_t s21_erfcx_seg(double a, double *d) {
+    int64_t bits;
+    memcpy(&bits, &a, sizeof(bits));
+    int64_t row = (bits >> 49) - (1022 << 3);
+    row = row > 0 ? row : 0;
+    row = row < s21_ERFCX_SEGS - 1 ? row : s21_ERFCX_SEGS - 1;
+    bits = (bits & ~((INT64_C(1) << 49) - 1)) | (INT64_C(1) << 48);
+    double center;
+    memcpy(&center, &bits, sizeof(center));
+    *d = a - center;
+    return row;
+}
+
+/*
+ * erfc(a) for 0.5 <= a < 27.5 as e^(-a^2) erfcx(a). a^2 is split into
+ * hi + lo so its rounding, up to 2^-46 relative at the top of the range,
+ * does not reach the result; e^(-hi) comes from the exp kernel and the
+ * low part is applied to first order. Other a give garbage, replaced by
+ * the callers; the argument is not clamped, which would let the compiler
+ * fold the clamped lanes and put the table lookups under a branch.
+ */
+static inline double s21_erfc_big(double a) {
+    double d;
+    int64_t row = s21_erfcx_seg(a, &d);
+    double hi = a * a, lo = s21_mul_err(a, a, hi);
+    double e = s21_exp_kernel(-hi);
+    return (e - e * lo) * s21_HORNER11(d, s21_erfcx_tab[row]);
+}
+
+static inline double s21_erf_small(double x) {
+    return x * s21_HORNER9(x * x, s21_erf_coef);
+}
+
+/*
+ * erf and erfc from tail = erfc(|x|), which is 0 in double from 27.5 on.
+ * erf is 1 - tail from 0.5 on, where the subtraction loses nothing; erfc
+ * keeps the tail itself, so it stays accurate far below 1, and takes
+ * 2 - tail for negative x. The batch forms compute the tails of a block
+ * first and pick here in a second pass: picked in the same loop, the
+ * table lookups would be moved under the branch and the loop would not
+ * be vectorized.
+ */
+static inline double s21_erf_pick(double x, double tail) {
+    double a = __builtin_fabs(x);
+    tail = a < 27.5 ? tail : 0.0;
+    double big = s21_copysign(1.0 - tail, x);
+    double res = a < 0.5 ? s21_erf_small(x) : big;
+    return a == a ? res : x;
+}
+
+static inline double s21_erfc_pick(double x, double tail) {
+    double a = __builtin_fabs(x);
+    tail = a < 27.5 ? tail : 0.0;
+    double big = (x < 0 ? 2.0 : 0.0) + s21_copysign(tail, x);
+    double res = a < 0.5 ? 1.0 - s21_erf_small(x) : big;
+    return a == a ? res : x;
+}
+
+long double s21_erf(double x) {
+    return s21_erf_pick(x, s21_erfc_big(__builtin_fabs(x)));
+}
+
+long double s21_erfc(double x) {
+    return s21_erfc_pick(x, s21_erfc_big(__builtin_fabs(x)));
+}
+
+void s21_erf_n(const double *in, double *out, size_t n) {
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) {
+            buf[j] = s21_erfc_big(__builtin_fabs(in[i + j]));
+        }
+        for (size_t j = 0; j < m; j++) {
+            out[i + j] = s21_erf_pick(in[i + j], buf[j]);
+        }
+    }
+}
+
+void s21_erfc_n(const double *in, double *out, size_t n) {
+    double buf[s21_BLOCK];
+    for (size_t i = 0; i < n; i += s21_BLOCK) {
+        size_t m = n - i < s21_BLOCK ? n - i : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) {
+            buf[j] = s21_erfc_big(__builtin_fabs(in[i + j]));
+        }
+        for (size_t j = 0; j < m; j++) {
+            out[i + j] = s21_erfc_pick(in[i + j], buf[j]);
+        }
+    }
+}
+
+/* Philox4x32-10 multipliers and Weyl key increments */
+#define s21_PHILOX_M0 0xD2511F53U
+#define s21_PHILOX_M1 0xCD9E8D57U
+#define s21_PHILOX_W0 0x9E3779B9U
+#define s21_PHILOX_W1 0xBB67AE85U
+
+static inline void s21_philox_rounds(uint32_t c[4], uint32_t k0,
+                                     uint32_t k1) {
+    for (int r = 0; r < 10; r++) {
+        uint64_t p0 = (uint64_t)s21_PHILOX_M0 * c[0];
+        uint64_t p1 = (uint64_t)s21_PHILOX_M1 * c[2];
+        uint32_t n0 = (uint32_t)(p1 >> 32) ^ c[1] ^ k0;
+        uint32_t n2 = (uint32_t)(p0 >> 32) ^ c[3] ^ k1;
+        c[1] = (uint32_t)p1;
+        c[3] = (uint32_t)p0;
+        c[0] = n0;
+        c[2] = n2;
+        k0 += s21_PHILOX_W0;
+        k1 += s21_PHILOX_W1;
+    }
+}
+
+void s21_philox4x32(const uint32_t ctr[4], const uint32_t key[2],
+                    uint32_t out[4]) {
+    uint32_t c[4] = {ctr[0], ctr[1], ctr[2], ctr[3]};
+    s21_philox_rounds(c, key[0], key[1]);
+    memcpy(out, c, sizeof(c));
+}
+
+void s21_philox_seed(s21_philox_state *state, uint64_t seed) {
+    state->key[0] = (uint32_t)seed;
+    state->key[1] = (uint32_t)(seed >> 32);
+    state->counter = 0;
+}
+
+/*
+ * 52 random bits as a double in (0, 1): the mantissa of a value in
+ * [1, 2), minus 1, plus half a step, so neither end is reached and the
+ * logarithm below needs no special cases.
+ */
+static inline double s21_philox_open01(uint32_t hi, uint32_t lo) {
+    uint64_t m = ((uint64_t)hi << 20) | (lo >> 12);
+    uint64_t bits = 0x3ff0000000000000ULL | (m & 0x000fffffffffffffULL);
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    return (d - 1.0) + 0x1.0p-53;
+}
+
+/*
+ * Normal k of the stream is component k % 2 of the Box-Muller pair made
+ * from Philox block k / 2, so the values depend only on the key and the
+ * position, never on how the calls split the stream. Each block of pairs
+ * is generated in three passes over local arrays, bits, then radius and
+ * angle through the log, sqrt and sinpi kernels, which keeps each pass a
+ * plain loop the compiler can vectorize.
+ */
+void s21_randn_n(s21_philox_state *state, double *out, size_t n) {
+    double u[s21_BLOCK], v[s21_BLOCK], z[2 * s21_BLOCK];
+    uint64_t k = state->counter;
+    size_t done = 0;
+    while (done < n) {
+        uint64_t first = k / 2;
+        size_t skip = (size_t)(k & 1);
+        size_t m = (n - done + skip + 1) / 2;
+        m = m < s21_BLOCK ? m : s21_BLOCK;
+        for (size_t j = 0; j < m; j++) {
+            uint64_t b = first + j;
+            uint32_t c[4] = {(uint32_t)b, (uint32_t)(b >> 32), 0, 0};
+            s21_philox_rounds(c, state->key[0], state->key[1]);
+            u[j] = s21_philox_open01(c[1], c[0]);
+            v[j] = s21_philox_open01(c[3], c[2]);
+        }
+        for (size_t j = 0; j < m; j++) {
+            double lo, e, hi = s21_log_parts(u[j], &lo, &e);
+            double r = s21_sqrt_d(-2.0 * s21_log_join(hi, lo, e));
+            double s, c;
+            s21_sincospi_fast(2.0 * v[j] - 1.0, &s, &c);
+            z[2 * j] = r * c;
+            z[2 * j + 1] = r * s;
+        }
+        size_t cnt = 2 * m - skip;
+        cnt = cnt < n - done ? cnt : n - done;
+        memcpy(out + done, z + skip, cnt * sizeof(double));
+        done += cnt;
+        k += cnt;
+    }
+    state->counter = k;
 }
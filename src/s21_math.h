@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "s21_poly.h"
+
 #define s21_PI 3.14159265358979323846264338327950288
 
 #define s21_true 1
@@ -40,6 +42,42 @@
  */
 int s21_abs(int x);
 
+/**
+ * @brief Saturating absolute values of an int8_t array: INT8_MIN, which
+ * has no positive counterpart, gives INT8_MAX.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_abs_i8_n(const int8_t *in, int8_t *out, size_t n);
+
+/**
+ * @brief Saturating absolute values of an int16_t array; INT16_MIN gives
+ * INT16_MAX.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_abs_i16_n(const int16_t *in, int16_t *out, size_t n);
+
+/**
+ * @brief Saturating absolute values of an int32_t array; INT32_MIN gives
+ * INT32_MAX.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_abs_i32_n(const int32_t *in, int32_t *out, size_t n);
+
+/**
+ * @brief Saturating absolute values of an int64_t array; INT64_MIN gives
+ * INT64_MAX.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_abs_i64_n(const int64_t *in, int64_t *out, size_t n);
+
 /**
  * @brief Returns the arccosine of x.
  * @param x Input value.
@@ -54,6 +92,24 @@ long double s21_acos(double x);
  */
 long double s21_asin(double x);
 
+/**
+ * @brief Computes s21_asin for every element of in, without branches per
+ * element; |x| > 1 gives NaN.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_asin_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_acos for every element of in, without branches per
+ * element; |x| > 1 gives NaN.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_acos_n(const double *in, double *out, size_t n);
+
 /**
  * @brief Returns the arctangent of x.
  * @param x Input value.
@@ -61,6 +117,187 @@ long double s21_asin(double x);
  */
 long double s21_atan(double x);
 
+/**
+ * @brief Returns the arctangent of y/x using the signs of both to pick the
+ * quadrant.
+ * @param y Ordinate.
+ * @param x Abscissa.
+ * @return Angle of the point (x, y) in radians, in [-pi, pi].
+ */
+long double s21_atan2(double y, double x);
+
+/**
+ * @brief Returns sqrt(x*x + y*y) without intermediate overflow or underflow.
+ * @param x First side.
+ * @param y Second side.
+ * @return Length of the hypotenuse.
+ */
+long double s21_hypot(double x, double y);
+
+/**
+ * @brief Computes atan(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_atan_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes atan2(y[i], x[i]) for every pair of elements.
+ * @param y Array of n ordinates.
+ * @param x Array of n abscissas.
+ * @param out Array of n results, may alias y or x.
+ * @param n Number of elements.
+ */
+void s21_atan2_n(const double *y, const double *x, double *out, size_t n);
+
+/**
+ * @brief Computes hypot(x[i], y[i]) for every pair of elements.
+ * @param x Array of n first sides.
+ * @param y Array of n second sides.
+ * @param out Array of n results, may alias x or y.
+ * @param n Number of elements.
+ */
+void s21_hypot_n(const double *x, const double *y, double *out, size_t n);
+
+/**
+ * @brief Computes the sine and cosine of x with one shared argument
+ * reduction.
+ * @param x Input value, in radians.
+ * @param s Receives sin(x).
+ * @param c Receives cos(x).
+ */
+void s21_sincos(double x, long double *s, long double *c);
+
+/**
+ * @brief Computes s21_sincos for every element of in.
+ * @param in Array of n angles, in radians.
+ * @param s Array of n sines, may alias in.
+ * @param c Array of n cosines, may alias in.
+ * @param n Number of elements.
+ */
+void s21_sincos_n(const double *in, double *s, double *c, size_t n);
+
+/**
+ * @brief Samples sine and cosine along an arithmetic sequence,
+ * s[k] = sin(x0 + k * dx) and c[k] = cos(x0 + k * dx), by rotating from
+ * exactly computed seeds that are refreshed every 64 samples. Costs a few
+ * multiply-adds per sample and adds a few ulp to the error the rounding of
+ * x0 + k * dx already carries.
+ * @param x0 First angle, in radians.
+ * @param dx Step between angles, in radians.
+ * @param s Array of n sines.
+ * @param c Array of n cosines, must not overlap s.
+ * @param n Number of samples.
+ */
+void s21_sincos_seq(double x0, double dx, double *s, double *c, size_t n);
+
+/**
+ * @brief Converts Cartesian points to polar form in a single pass:
+ * r[i] = hypot(x[i], y[i]), theta[i] = atan2(y[i], x[i]).
+ * @param x Array of n abscissas.
+ * @param y Array of n ordinates.
+ * @param r Array of n radii, may alias x or y.
+ * @param theta Array of n angles in [-pi, pi], may alias x or y.
+ * @param n Number of elements.
+ */
+void s21_cart2polar_n(const double *x, const double *y, double *r,
+                      double *theta, size_t n);
+
+/**
+ * @brief Converts polar points to Cartesian form in a single pass:
+ * x[i] = r[i] * cos(theta[i]), y[i] = r[i] * sin(theta[i]).
+ * @param r Array of n radii.
+ * @param theta Array of n angles, in radians.
+ * @param x Array of n abscissas, may alias r or theta.
+ * @param y Array of n ordinates, may alias r or theta.
+ * @param n Number of elements.
+ */
+void s21_polar2cart_n(const double *r, const double *theta, double *x,
+                      double *y, size_t n);
+
+/**
+ * @brief Computes sin(pi * x). The reduction subtracts the nearest
+ * half-integer, which is exact, so no rounding of pi * x is involved.
+ * Integers give a zero with the sign of x.
+ * @param x Angle, in half turns.
+ * @return sin(pi * x), or NaN for infinite or NaN x.
+ */
+long double s21_sinpi(double x);
+
+/**
+ * @brief Computes cos(pi * x), reduced exactly like s21_sinpi. Half
+ * integers give +0.
+ * @param x Angle, in half turns.
+ * @return cos(pi * x), or NaN for infinite or NaN x.
+ */
+long double s21_cospi(double x);
+
+/**
+ * @brief Computes tan(pi * x), reduced exactly like s21_sinpi. Half
+ * integers n + 1/2 give +inf for even n and -inf for odd n.
+ * @param x Angle, in half turns.
+ * @return tan(pi * x), or NaN for infinite or NaN x.
+ */
+long double s21_tanpi(double x);
+
+/**
+ * @brief Computes the sine of an angle in degrees. The reduction
+ * subtracts the nearest multiple of 90, which is exact, so multiples of
+ * 30 and 90 give exact results where the true value is representable.
+ * @param x Angle, in degrees.
+ * @return sin(x degrees), or NaN for infinite or NaN x.
+ */
+long double s21_sind(double x);
+
+/**
+ * @brief Computes the cosine of an angle in degrees, reduced exactly like
+ * s21_sind.
+ * @param x Angle, in degrees.
+ * @return cos(x degrees), or NaN for infinite or NaN x.
+ */
+long double s21_cosd(double x);
+
+/**
+ * @brief Computes s21_sinpi for every element of in.
+ * @param in Array of n angles, in half turns.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_sinpi_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_cospi for every element of in.
+ * @param in Array of n angles, in half turns.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_cospi_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_tanpi for every element of in.
+ * @param in Array of n angles, in half turns.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_tanpi_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_sind for every element of in.
+ * @param in Array of n angles, in degrees.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_sind_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_cosd for every element of in.
+ * @param in Array of n angles, in degrees.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_cosd_n(const double *in, double *out, size_t n);
+
 /**
  * @brief Rounds x to the smallest integer not less than x.
  * @param x Input value.
@@ -82,6 +319,131 @@ long double s21_cos(double x);
  */
 long double s21_exp(double x);
 
+/**
+ * @brief Returns 2 raised to the power x.
+ * @param x Input value.
+ * @return 2^x.
+ */
+long double s21_exp2(double x);
+
+/**
+ * @brief Returns 10 raised to the power x.
+ * @param x Input value.
+ * @return 10^x.
+ */
+long double s21_exp10(double x);
+
+/**
+ * @brief Returns e^x - 1, accurate for x near zero.
+ * @param x Input value.
+ * @return e^x - 1.
+ */
+long double s21_expm1(double x);
+
+/**
+ * @brief Computes e^x for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_exp_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes 2^x for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_exp2_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes 10^x for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_exp10_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes e^x - 1 for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_expm1_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the hyperbolic sine of x.
+ * @param x Input value.
+ * @return sinh(x), or +-inf when the result overflows.
+ */
+long double s21_sinh(double x);
+
+/**
+ * @brief Computes the hyperbolic cosine of x.
+ * @param x Input value.
+ * @return cosh(x), or inf when the result overflows.
+ */
+long double s21_cosh(double x);
+
+/**
+ * @brief Computes the hyperbolic tangent of x.
+ * @param x Input value.
+ * @return tanh(x), saturating to +-1 for large |x|.
+ */
+long double s21_tanh(double x);
+
+/**
+ * @brief Computes sinh(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_sinh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes cosh(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_cosh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes tanh(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_tanh_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the logistic function 1 / (1 + e^-x) for every element
+ * of an array without overflow for either sign of x.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_sigmoid_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes e^in[i] / sum(e^in[j]) with the maximum subtracted
+ * first, in two streaming passes over in.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_softmax_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes log(sum(e^in[i])) with the maximum subtracted first, in
+ * one streaming pass over in.
+ * @param in Array of n inputs.
+ * @param n Number of elements.
+ * @return The log of the sum, -inf when n is 0.
+ */
+long double s21_logsumexp_n(const double *in, size_t n);
+
 /**
  * @brief Returns the absolute value of x.
  * @param x Input value.
@@ -111,6 +473,201 @@ long double s21_fmod(double x, double y);
  */
 long double s21_log(double x);
 
+/**
+ * @brief Returns the base 2 logarithm of x.
+ * @param x Input value.
+ * @return Base 2 logarithm of x.
+ */
+long double s21_log2(double x);
+
+/**
+ * @brief Returns the base 10 logarithm of x.
+ * @param x Input value.
+ * @return Base 10 logarithm of x.
+ */
+long double s21_log10(double x);
+
+/**
+ * @brief Returns the natural logarithm of 1 + x, accurate for x near zero.
+ * @param x Input value.
+ * @return log(1 + x).
+ */
+long double s21_log1p(double x);
+
+/**
+ * @brief Computes log(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_log_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes log2(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_log2_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes log10(x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_log10_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes log(1 + x) for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_log1p_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Returns floor(log2(n)), the index of the highest set bit.
+ * @param n Input value.
+ * @return floor(log2(n)), or -1 for n = 0.
+ */
+int s21_ilog2(uint64_t n);
+
+/**
+ * @brief Returns floor(log10(n)), one less than the number of decimal
+ * digits of n.
+ * @param n Input value.
+ * @return floor(log10(n)), or -1 for n = 0.
+ */
+int s21_ilog10(uint64_t n);
+
+/**
+ * @brief Computes s21_ilog2 for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results.
+ * @param n Number of elements.
+ */
+void s21_ilog2_n(const uint64_t *in, int *out, size_t n);
+
+/**
+ * @brief Computes s21_ilog10 for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results.
+ * @param n Number of elements.
+ */
+void s21_ilog10_n(const uint64_t *in, int *out, size_t n);
+
+/**
+ * @brief Returns n! from a table of the values for n = 0..170.
+ * @param n Input value.
+ * @return n! rounded to double, inf for n > 170, NaN for negative n.
+ */
+long double s21_factorial(int n);
+
+/**
+ * @brief Computes the gamma function with the Lanczos approximation, at
+ * the same cost for every argument.
+ * @param x Input value.
+ * @return gamma(x); +-inf at +-0, NaN at negative integers and -inf.
+ */
+long double s21_tgamma(double x);
+
+/**
+ * @brief Computes log|gamma(x)|, without overflow for large x.
+ * @param x Input value.
+ * @return log|gamma(x)|; +inf at 0, negative integers and +-inf.
+ */
+long double s21_lgamma(double x);
+
+/**
+ * @brief Computes s21_tgamma for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_tgamma_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_lgamma for every element of an array, e.g. the
+ * log-gamma terms of many log-binomial coefficients at once.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_lgamma_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes the error function.
+ * @param x Input value.
+ * @return erf(x), in [-1, 1].
+ */
+long double s21_erf(double x);
+
+/**
+ * @brief Computes the complementary error function 1 - erf(x), accurate
+ * in the upper tail where 1 - erf(x) would cancel.
+ * @param x Input value.
+ * @return erfc(x), in [0, 2].
+ */
+long double s21_erfc(double x);
+
+/**
+ * @brief Computes s21_erf for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_erf_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes s21_erfc for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_erfc_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Computes one Philox4x32-10 block, the counter-based generator of
+ * Salmon et al. (SC 2011): ten rounds that turn a 128-bit counter and a
+ * 64-bit key into 128 random bits.
+ * @param ctr Counter, four 32-bit words.
+ * @param key Key, two 32-bit words.
+ * @param out Receives the four random words.
+ */
+void s21_philox4x32(const uint32_t ctr[4], const uint32_t key[2],
+                    uint32_t out[4]);
+
+/**
+ * @brief State of a Philox stream: the key and the position of the next
+ * value. Values depend only on these two, so a copy with counter moved to
+ * offset i produces what the original would from its i-th value on; a
+ * range split across threads that way gives the same numbers for any
+ * thread count.
+ */
+typedef struct {
+    uint32_t key[2];
+    uint64_t counter;
+} s21_philox_state;
+
+/**
+ * @brief Starts a stream keyed by seed, at position 0.
+ * @param state State to set up.
+ * @param seed Key of the stream.
+ */
+void s21_philox_seed(s21_philox_state *state, uint64_t seed);
+
+/**
+ * @brief Fills out with standard normal samples by the Box-Muller
+ * transform of Philox output, and advances state->counter by n.
+ * Consecutive calls continue the stream, so the result does not depend
+ * on how it is split between calls.
+ * @param state Stream to draw from.
+ * @param out Array of n samples.
+ * @param n Number of samples.
+ */
+void s21_randn_n(s21_philox_state *state, double *out, size_t n);
+
 /**
  * @brief Returns base raised to the power exp.
  * @param base Base value.
@@ -133,6 +690,74 @@ long double s21_sin(double x);
  */
 long double s21_sqrt(double n);
 
+/**
+ * @brief Square roots of every element of an array, correctly rounded.
+ * Negative inputs give NaN, -0 gives -0.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_sqrt_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Reciprocal square roots 1/sqrt(x) of every element of an array,
+ * within an ulp. +-0 gives +-inf, +inf gives +0, negative inputs NaN.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_rsqrt_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Memory layout of an array of 3D vectors.
+ */
+typedef enum {
+    s21_LAYOUT_AOS, /* x0 y0 z0 x1 y1 z1 ... */
+    s21_LAYOUT_SOA  /* x0 x1 ... then y0 y1 ... then z0 z1 ... */
+} s21_layout;
+
+/**
+ * @brief Scales every 3D vector of an array to unit length. Zero vectors
+ * stay zero; vectors with an infinite or NaN component become NaN.
+ * @param in Array of 3 * n doubles holding n vectors.
+ * @param out Array of 3 * n results in the same layout, may alias in.
+ * @param n Number of vectors.
+ * @param layout Layout of in and out.
+ */
+void s21_normalize3_n(const double *in, double *out, size_t n,
+                      s21_layout layout);
+
+/**
+ * @brief Returns the integer square root of n, floor(sqrt(n)), exactly.
+ * @param n Input value.
+ * @return The largest r with r * r <= n.
+ */
+uint32_t s21_isqrt_u32(uint32_t n);
+
+/**
+ * @brief Returns the integer square root of n, floor(sqrt(n)), exactly,
+ * also above 2^53 where a double no longer holds n.
+ * @param n Input value.
+ * @return The largest r with r * r <= n.
+ */
+uint64_t s21_isqrt_u64(uint64_t n);
+
+/**
+ * @brief Computes s21_isqrt_u32 for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_isqrt_u32_n(const uint32_t *in, uint32_t *out, size_t n);
+
+/**
+ * @brief Computes s21_isqrt_u64 for every element of an array.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_isqrt_u64_n(const uint64_t *in, uint64_t *out, size_t n);
+
 /**
  * @brief Returns the tangent of x.
  * @param x Input value.
@@ -155,4 +780,377 @@ s21_bool s21_ldeq(long double a, long double b);
  */
 long double s21_atan_cust(double x);
 
+/**
+ * @brief Classification of a prepared pow base.
+ */
+typedef enum {
+    s21_POW_NAN,
+    s21_POW_ONE,
+    s21_POW_ZERO,
+    s21_POW_INF,
+    s21_POW_FINITE
+} s21_pow_kind;
+
+/**
+ * @brief Prepared base for repeated s21_pow_apply calls.
+ *
+ * Holds the classified base and log|base| as a pair of doubles
+ * log_hi + log_lo, so that each apply call costs one exp.
+ */
+typedef struct {
+    double base;
+    double log_hi;
+    double log_lo;
+    s21_pow_kind kind;
+} s21_pow_base;
+
+/**
+ * @brief Prepares base for raising to many exponents.
+ * @param base Base value.
+ * @return Handle to pass to s21_pow_apply and s21_pow_apply_n.
+ */
+s21_pow_base s21_pow_prepare(double base);
+
+/**
+ * @brief Returns the prepared base raised to the power exp.
+ * @param h Handle from s21_pow_prepare.
+ * @param exp Exponent value.
+ * @return base^exp with C99 special-case semantics.
+ */
+long double s21_pow_apply(const s21_pow_base *h, double exp);
+
+/**
+ * @brief Raises the prepared base to every exponent of an array.
+ *
+ * A finite base runs one exp per element, branch-free, and then patches
+ * infinite, NaN and, for negative bases, odd or fractional exponents.
+ * @param h Handle from s21_pow_prepare.
+ * @param exp Array of n exponents.
+ * @param out Array of n results, may alias exp.
+ * @param n Number of elements.
+ */
+void s21_pow_apply_n(const s21_pow_base *h, const double *exp, double *out,
+                     size_t n);
+
+/**
+ * @brief Raises every element of an array to the same power.
+ *
+ * The exponent is classified once: 0, 1, 2, -1 and 0.5 get dedicated loops,
+ * integers up to 8 in magnitude a square-and-multiply chain in double,
+ * any other finite exponent a branch-free log-mul-exp on the shared log
+ * and exp cores, with zeros, infinities and negative bases patched in a
+ * second pass per block.
+ * @param in Array of n bases.
+ * @param exp Exponent shared by all elements.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_pow_n_fixed_exp(const double *in, double exp, double *out, size_t n);
+
+/**
+ * @brief Returns x raised to the integer power n.
+ * @param x Base value.
+ * @param n Integer exponent.
+ * @return x^n, computed by binary exponentiation.
+ */
+long double s21_powi(double x, int n);
+
+/**
+ * @brief Minimal multiplication chain for |n| <= 8, see s21_powi_const.
+ */
+static inline long double s21_powi_chain(long double x, int n) {
+    long double x2 = x * x, x4 = x2 * x2, r;
+    switch (n < 0 ? -n : n) {
+        case 0:
+            r = 1.0L;
+            break;
+        case 1:
+            r = x;
+            break;
+        case 2:
+            r = x2;
+            break;
+        case 3:
+            r = x2 * x;
+            break;
+        case 4:
+            r = x4;
+            break;
+        case 5:
+            r = x4 * x;
+            break;
+        case 6:
+            r = x4 * x2;
+            break;
+        case 7:
+            r = x4 * x2 * x;
+            break;
+        default:
+            r = x4 * x4;
+            break;
+    }
+    return n < 0 ? 1.0L / r : r;
+}
+
+/**
+ * @brief s21_powi that folds into straight-line multiplications when n is a
+ * compile-time constant in [-8, 8], e.g. s21_powi_const(x, 3) is x * x * x.
+ */
+#define s21_powi_const(x, n)                                \
+    ((__builtin_constant_p(n) && (n) >= -8 && (n) <= 8)     \
+         ? s21_powi_chain((x), (n))                         \
+         : s21_powi((x), (n)))
+
+/**
+ * @brief Piecewise Chebyshev approximation of a function on [lo, hi].
+ *
+ * The interval is split into segs equal segments, each holding stride
+ * Chebyshev coefficients in coef. Built by s21_cheb_build, released with
+ * s21_cheb_free.
+ */
+typedef struct {
+    double lo, hi;
+    double scale;
+    double err;
+    int segs;
+    int stride;
+    double coef[];
+} s21_cheb;
+
+/**
+ * @brief Fits a piecewise Chebyshev approximation to f.
+ *
+ * The number of segments doubles, up to 4096, until a fit with at most 16
+ * coefficients per segment meets the tolerance; trailing coefficients
+ * that the tolerance allows are dropped.
+ * @param f Function to approximate, sampled only inside [lo, hi].
+ * @param lo Lower end of the interval.
+ * @param hi Upper end of the interval.
+ * @param tol Absolute error to reach.
+ * @return The approximation, or NULL when the arguments are invalid, the
+ * tolerance cannot be met or memory runs out.
+ */
+s21_cheb *s21_cheb_build(double (*f)(double), double lo, double hi,
+                         double tol);
+
+/**
+ * @brief Evaluates a Chebyshev approximation.
+ * @param ch Approximation from s21_cheb_build.
+ * @param x Point of evaluation.
+ * @return The approximate f(x), or NaN outside [lo, hi].
+ */
+long double s21_cheb_eval(const s21_cheb *ch, double x);
+
+/**
+ * @brief Evaluates a Chebyshev approximation at every element of an array.
+ * @param ch Approximation from s21_cheb_build.
+ * @param in Array of n points.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_cheb_eval_n(const s21_cheb *ch, const double *in, double *out,
+                     size_t n);
+
+/**
+ * @brief Releases an approximation from s21_cheb_build; NULL is ignored.
+ * @param ch Approximation to release.
+ */
+void s21_cheb_free(s21_cheb *ch);
+
+/**
+ * @brief Interpolation used between the samples of a s21_table.
+ */
+typedef enum { s21_TABLE_LINEAR, s21_TABLE_CUBIC } s21_table_interp;
+
+/**
+ * @brief Function sampled at size equally spaced points of [lo, hi].
+ *
+ * Linear tables hold one value per point, cubic ones a value and a slope
+ * side by side, starting on a cache line. err is the largest error seen
+ * between the samples when the table was built. Built by s21_table_build,
+ * released with s21_table_free.
+ */
+typedef struct {
+    double lo, hi;
+    double scale;
+    double err;
+    size_t size;
+    s21_table_interp interp;
+    double *val;
+} s21_table;
+
+/**
+ * @brief Tabulates func for fast low-precision evaluation.
+ * @param func Function to tabulate, sampled only inside [lo, hi]; any of
+ * the s21 functions of one double.
+ * @param lo Lower end of the interval.
+ * @param hi Upper end of the interval.
+ * @param size Number of sample points, at least 2 for linear and 3 for
+ * cubic interpolation.
+ * @param interp s21_TABLE_LINEAR or s21_TABLE_CUBIC (Hermite, with slopes
+ * estimated from the samples).
+ * @return The table, or NULL for invalid arguments or when memory runs
+ * out. The achieved max error is in its err field.
+ */
+s21_table *s21_table_build(long double (*func)(double), double lo, double hi,
+                           size_t size, s21_table_interp interp);
+
+/**
+ * @brief Interpolates a table at x.
+ * @param tb Table from s21_table_build.
+ * @param x Point of evaluation.
+ * @return The interpolated value, or NaN outside [lo, hi].
+ */
+long double s21_table_eval(const s21_table *tb, double x);
+
+/**
+ * @brief Interpolates a table at every element of an array.
+ * @param tb Table from s21_table_build.
+ * @param in Array of n points.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_table_eval_n(const s21_table *tb, const double *in, double *out,
+                      size_t n);
+
+/**
+ * @brief Releases a table from s21_table_build; NULL is ignored.
+ * @param tb Table to release.
+ */
+void s21_table_free(s21_table *tb);
+
+/**
+ * @brief Twiddle factors of an n-point FFT, re[k] = cos(2 pi k / n) and
+ * im[k] = sin(2 pi k / n) for k < n. Both arrays start on a 64-byte cache
+ * line. Tables are shared and immutable, and stay valid until the process
+ * exits.
+ */
+typedef struct {
+    size_t n;
+    const double *re;
+    const double *im;
+} s21_twiddles;
+
+/**
+ * @brief Returns the twiddle table for n, computing it on the first call
+ * for that n. Any n works, not only powers of two. The angles are reduced
+ * exactly, so the values are within about an ulp of the true ones. Safe to
+ * call from several threads.
+ * @param n Transform length.
+ * @return The shared table, or NULL when n is 0 or memory runs out.
+ */
+const s21_twiddles *s21_twiddles_get(size_t n);
+
+/**
+ * @brief Like s21_twiddles_get, but a table that is not cached yet is
+ * first mapped from path, and a computed table, cached or not, is written
+ * there when the file does not hold it, so later processes skip the
+ * computation. The file is native endian, readable by its owner only and
+ * written through a temporary rename, so concurrent readers never see it
+ * half done; failing to write it is not an error.
+ * @param n Transform length.
+ * @param path Cache file for this n; NULL behaves as s21_twiddles_get.
+ * @return The shared table, or NULL when n is 0 or memory runs out.
+ */
+const s21_twiddles *s21_twiddles_map(size_t n, const char *path);
+
+/**
+ * @brief Rounds every element of in down, as s21_floor.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_floor_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Rounds every element of in up, as s21_ceil.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_ceil_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Rounds every element of in toward zero.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_trunc_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Rounds every element of in to the nearest integer, halfway cases
+ * away from zero.
+ * @param in Array of n inputs.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_round_n(const double *in, double *out, size_t n);
+
+/**
+ * @brief Rounding applied by s21_to_int32_n and s21_to_int64_n.
+ */
+typedef enum {
+    s21_ROUND_FLOOR,
+    s21_ROUND_CEIL,
+    s21_ROUND_TRUNC,
+    s21_ROUND_NEAREST /* halfway cases away from zero */
+} s21_round_mode;
+
+/**
+ * @brief Rounds every element of in and stores it as int32_t, e.g. as
+ * bucket indices. Values beyond the range of int32_t saturate, NaN gives 0.
+ * @param in Array of n inputs.
+ * @param out Array of n results.
+ * @param n Number of elements.
+ * @param mode Rounding to apply.
+ */
+void s21_to_int32_n(const double *in, int32_t *out, size_t n,
+                    s21_round_mode mode);
+
+/**
+ * @brief Rounds every element of in and stores it as int64_t. Values
+ * beyond the range of int64_t saturate, NaN gives 0.
+ * @param in Array of n inputs.
+ * @param out Array of n results.
+ * @param n Number of elements.
+ * @param mode Rounding to apply.
+ */
+void s21_to_int64_n(const double *in, int64_t *out, size_t n,
+                    s21_round_mode mode);
+
+/**
+ * @brief Prepared divisor for s21_fmod_n_fixed.
+ *
+ * Holds |y|, its reciprocal and its split into two halves of 26 bits, so
+ * the per-element work is a multiply, a truncation and an exact
+ * multiply-subtract.
+ */
+typedef struct {
+    double y;
+    double ay;
+    double inv;
+    double ay_hi, ay_lo;
+    double limit; /* quotients below it take the fast path */
+} s21_fmod_divisor;
+
+/**
+ * @brief Prepares y for taking many remainders by it.
+ * @param y Divisor.
+ * @return Handle to pass to s21_fmod_n_fixed.
+ */
+s21_fmod_divisor s21_fmod_prepare(double y);
+
+/**
+ * @brief Computes fmod(in[i], y) for every element, exactly and with the C
+ * special cases: NaN for an infinite x or a zero y, x for an infinite y.
+ * Large quotients fall back to an exact long division.
+ * @param d Handle from s21_fmod_prepare.
+ * @param in Array of n dividends.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_fmod_n_fixed(const s21_fmod_divisor *d, const double *in,
+                      double *out, size_t n);
+
 #endif  // SRC_S21_MATH_H_
@@ -0,0 +1,98 @@
+#ifndef SRC_S21_POLY_H_
+#define SRC_S21_POLY_H_
+
+#include <stddef.h>
+
+/*
+ * Polynomial evaluation. Coefficients are stored lowest degree first,
+ * c[0] + c[1] x + ... + c[n-1] x^(n-1), in arrays of n doubles.
+ */
+
+/* a * b + c, with a single rounding when the target has FMA */
+#if defined(__FMA__) || defined(__aarch64__)
+#define s21_FMA(a, b, c) __builtin_fma((a), (b), (c))
+#else
+#define s21_FMA(a, b, c) ((a) * (b) + (c))
+#endif
+
+/* largest coefficient count s21_poly_estrin accepts */
+#define s21_POLY_MAX 32
+
+/*
+ * Horner scheme unrolled by the preprocessor. The arguments are expanded
+ * several times, so they should not have side effects.
+ */
+#define s21_HORNER1(x, c) ((c)[0])
+#define s21_HORNER2(x, c) s21_FMA((x), (c)[1], (c)[0])
+#define s21_HORNER3(x, c) s21_FMA((x), s21_HORNER2(x, (c) + 1), (c)[0])
+#define s21_HORNER4(x, c) s21_FMA((x), s21_HORNER3(x, (c) + 1), (c)[0])
+#define s21_HORNER5(x, c) s21_FMA((x), s21_HORNER4(x, (c) + 1), (c)[0])
+#define s21_HORNER6(x, c) s21_FMA((x), s21_HORNER5(x, (c) + 1), (c)[0])
+#define s21_HORNER7(x, c) s21_FMA((x), s21_HORNER6(x, (c) + 1), (c)[0])
+#define s21_HORNER8(x, c) s21_FMA((x), s21_HORNER7(x, (c) + 1), (c)[0])
+#define s21_HORNER9(x, c) s21_FMA((x), s21_HORNER8(x, (c) + 1), (c)[0])
+#define s21_HORNER10(x, c) s21_FMA((x), s21_HORNER9(x, (c) + 1), (c)[0])
+#define s21_HORNER11(x, c) s21_FMA((x), s21_HORNER10(x, (c) + 1), (c)[0])
+#define s21_HORNER12(x, c) s21_FMA((x), s21_HORNER11(x, (c) + 1), (c)[0])
+
+/*
+ * Estrin scheme unrolled by the preprocessor, for 4, 8 and 16
+ * coefficients. The caller passes the powers x^2, x^4 and x^8 so they can
+ * be shared between several polynomials. The dependency chain is log2(n)
+ * multiply-adds long instead of n, which helps when latency dominates.
+ */
+#define s21_ESTRIN4(x, x2, c) \
+    s21_FMA((x2), s21_HORNER2(x, (c) + 2), s21_HORNER2(x, c))
+#define s21_ESTRIN8(x, x2, x4, c) \
+    s21_FMA((x4), s21_ESTRIN4(x, x2, (c) + 4), s21_ESTRIN4(x, x2, c))
+#define s21_ESTRIN16(x, x2, x4, x8, c)             \
+    s21_FMA((x8), s21_ESTRIN8(x, x2, x4, (c) + 8), \
+            s21_ESTRIN8(x, x2, x4, c))
+
+/**
+ * @brief Evaluates a polynomial with the Horner scheme.
+ * @param x Point of evaluation.
+ * @param c Array of n coefficients, lowest degree first.
+ * @param n Number of coefficients; 0 gives the zero polynomial.
+ * @return The value of the polynomial at x.
+ */
+static inline double s21_poly_horner(double x, const double *c, int n) {
+    double res = n > 0 ? c[n - 1] : 0.0;
+    for (int k = n - 2; k >= 0; k--) res = s21_FMA(res, x, c[k]);
+    return res;
+}
+
+/**
+ * @brief Evaluates a polynomial with the Estrin scheme, pairing terms and
+ * squaring x at every level. With a constant n, -O3 unrolls the loops and
+ * drops the scratch array; the macros above unroll at any level.
+ * @param x Point of evaluation.
+ * @param c Array of n coefficients, lowest degree first.
+ * @param n Number of coefficients, at most s21_POLY_MAX.
+ * @return The value of the polynomial at x.
+ */
+static inline double s21_poly_estrin(double x, const double *c, int n) {
+    double t[s21_POLY_MAX];
+    for (int k = 0; k < n; k++) t[k] = c[k];
+    for (int m = n; m > 1; m = (m + 1) / 2) {
+        for (int k = 0; 2 * k + 1 < m; k++) {
+            t[k] = s21_FMA(x, t[2 * k + 1], t[2 * k]);
+        }
+        if (m % 2) t[m / 2] = t[m - 1];
+        x *= x;
+    }
+    return n > 0 ? t[0] : 0.0;
+}
+
+/**
+ * @brief Evaluates one polynomial at every element of an array.
+ * @param c Array of n_coef coefficients, lowest degree first.
+ * @param n_coef Number of coefficients.
+ * @param in Array of n points.
+ * @param out Array of n results, may alias in.
+ * @param n Number of elements.
+ */
+void s21_poly_n(const double *c, int n_coef, const double *in, double *out,
+                size_t n);
+
+#endif  // SRC_S21_POLY_H_
@@ -34,6 +34,78 @@ END_TEST
 START_TEST(abs_10) { ck_assert_int_eq(s21_abs(0), abs(0)); }
 END_TEST
 
+START_TEST(abs_11) {
+  /* 100 elements leave a tail after the vector loop */
+  int8_t in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (int8_t)(i * 37 - 1800);
+  in[0] = INT8_MIN;
+  in[1] = INT8_MAX;
+  in[2] = INT8_MIN + 1;
+  in[99] = INT8_MIN;
+  s21_abs_i8_n(in, out, 100);
+  for (int i = 0; i < 100; i++) {
+    int want = abs(in[i]);
+    ck_assert_int_eq(out[i], want > INT8_MAX ? INT8_MAX : want);
+  }
+  s21_abs_i8_n(in, in, 100);
+  ck_assert_int_eq(memcmp(in, out, sizeof(in)), 0);
+}
+END_TEST
+
+START_TEST(abs_12) {
+  int16_t in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (int16_t)(i * 661 - 33000);
+  in[0] = INT16_MIN;
+  in[1] = INT16_MAX;
+  in[98] = INT16_MIN;
+  s21_abs_i16_n(in, out, 100);
+  for (int i = 0; i < 100; i++) {
+    int want = abs(in[i]);
+    ck_assert_int_eq(out[i], want > INT16_MAX ? INT16_MAX : want);
+  }
+}
+END_TEST
+
+START_TEST(abs_13) {
+  int32_t in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (int32_t)(i * 43000000LL - 2e9);
+  in[0] = INT32_MIN;
+  in[1] = INT32_MAX;
+  in[2] = INT32_MIN + 1;
+  in[97] = INT32_MIN;
+  s21_abs_i32_n(in, out, 100);
+  for (int i = 0; i < 100; i++) {
+    long long want = llabs(in[i]);
+    ck_assert_int_eq(out[i], want > INT32_MAX ? INT32_MAX : want);
+  }
+  /* the clamp of the scalar for everything it defines */
+  for (int i = 1; i < 100; i++) {
+    if (in[i] != INT32_MIN) ck_assert_int_eq(out[i], s21_abs(in[i]));
+  }
+}
+END_TEST
+
+START_TEST(abs_14) {
+  int64_t in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (i - 50) * 184467440737095516LL;
+  in[0] = INT64_MIN;
+  in[1] = INT64_MAX;
+  in[2] = INT64_MIN + 1;
+  in[96] = INT64_MIN;
+  s21_abs_i64_n(in, out, 100);
+  ck_assert_int_eq(out[0], INT64_MAX);
+  ck_assert_int_eq(out[1], INT64_MAX);
+  ck_assert_int_eq(out[2], INT64_MAX);
+  ck_assert_int_eq(out[96], INT64_MAX);
+  for (int i = 3; i < 96; i++) {
+    ck_assert_int_eq(out[i], llabs((i - 50) * 184467440737095516LL));
+  }
+  /* in place gives the same */
+  s21_abs_i64_n(in, in, 100);
+  ck_assert_int_eq(memcmp(in, out, sizeof(in)), 0);
+}
+END_TEST
+
 Suite* test_abs(void) {
   Suite* s1 = suite_create("s21_abs");
   TCase* tc1 = tcase_create("case_abs");
@@ -48,6 +120,10 @@ Suite* test_abs(void) {
   tcase_add_test(tc1, abs_8);
   tcase_add_test(tc1, abs_9);
   tcase_add_test(tc1, abs_10);
+  tcase_add_test(tc1, abs_11);
+  tcase_add_test(tc1, abs_12);
+  tcase_add_test(tc1, abs_13);
+  tcase_add_test(tc1, abs_14);
 
   suite_add_tcase(s1, tc1);
   return s1;
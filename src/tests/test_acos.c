@@ -121,6 +121,39 @@ START_TEST(acos_19) {
 }
 END_TEST
 
+START_TEST(acos_20) {
+  for (double x = -1; x <= 1; x += 0.0000613) {
+    long double want = acosl(x);
+    ck_assert_ldouble_le(fabsl(s21_acos(x) - want), want * 0x1.1p-52L);
+  }
+  ck_assert_ldouble_eq(s21_acos(1), 0);
+  ck_assert_ldouble_eq(s21_acos(-1), 0x1.921fb54442d18p+1);
+  ck_assert_ldouble_eq(s21_acos(0), 0x1.921fb54442d18p+0);
+  ck_assert_ldouble_eq(s21_acos(-0.5), 0x1.0c152382d7366p+1);
+}
+END_TEST
+
+START_TEST(acos_21) {
+  double in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (i - 50) * 0.0213;
+  in[3] = NAN;
+  in[4] = -INFINITY;
+  s21_acos_n(in, out, 100);
+  for (int i = 0; i < 100; i++) {
+    long double want = s21_acos(in[i]);
+    if (isnan(want)) {
+      ck_assert_double_nan(out[i]);
+    } else {
+      ck_assert_double_eq(out[i], want);
+    }
+  }
+  ck_assert_double_nan(out[3]);
+  ck_assert_double_nan(out[1]);
+  s21_acos_n(in, in, 100);
+  ck_assert_double_eq(in[50], out[50]);
+}
+END_TEST
+
 Suite* test_acos(void) {
   Suite* s2;
   TCase* tc2;
@@ -146,6 +179,8 @@ Suite* test_acos(void) {
   tcase_add_test(tc2, acos_17);
   tcase_add_test(tc2, acos_18);
   tcase_add_test(tc2, acos_19);
+  tcase_add_test(tc2, acos_20);
+  tcase_add_test(tc2, acos_21);
 
   suite_add_tcase(s2, tc2);
   return s2;
@@ -0,0 +1,72 @@
+#include "tests.h"
+
+START_TEST(activation_1) {
+  double in[40], out[40];
+  for (int i = 0; i < 40; i++) in[i] = (i - 20) * 2.3;
+  in[0] = -800;
+  in[39] = 800;
+  s21_sigmoid_n(in, out, 40);
+  for (int i = 0; i < 40; i++) {
+    double orig = 1 / (1 + exp(-in[i]));
+    /* orig is exactly 0 at -800, where a relative tolerance admits
+       nothing */
+    ck_assert_double_eq_tol(out[i], orig, fmax(1e-15 * orig, 1e-300));
+  }
+  s21_sigmoid_n(in, in, 40);
+  ck_assert_double_eq(in[0], 0);
+  ck_assert_double_eq(in[39], 1);
+}
+END_TEST
+
+START_TEST(activation_2) {
+  double in[150], out[150];
+  long double sum = 0;
+  for (int i = 0; i < 150; i++) {
+    in[i] = (i % 13) * 3.1 + (i > 100 ? 600 : 0);
+    sum += expl(in[i] - 637.2L);
+  }
+  s21_softmax_n(in, out, 150);
+  double total = 0;
+  for (int i = 0; i < 150; i++) {
+    double orig = expl(in[i] - 637.2L) / sum;
+    ck_assert_double_eq_tol(out[i], orig, 1e-13 * orig);
+    total += out[i];
+  }
+  ck_assert_double_eq_tol(total, 1, 1e-14);
+  ck_assert_ldouble_eq_tol(s21_logsumexp_n(in, 150), 637.2L + logl(sum),
+                           1e-12);
+}
+END_TEST
+
+START_TEST(activation_3) {
+  double v[] = {1000, 1001, 999};
+  ck_assert_ldouble_eq_tol(s21_logsumexp_n(v, 3),
+                           1001 + log(1 + exp(-1) + exp(-2)), 1e-12);
+  ck_assert_ldouble_eq(s21_logsumexp_n(v, 0), -INFINITY);
+  double w[] = {-INFINITY, -INFINITY};
+  ck_assert_ldouble_eq(s21_logsumexp_n(w, 2), -INFINITY);
+  double x[] = {1, INFINITY};
+  ck_assert_ldouble_eq(s21_logsumexp_n(x, 2), INFINITY);
+  double y[] = {1, NAN, 3};
+  ck_assert_ldouble_nan(s21_logsumexp_n(y, 3));
+  double out[3];
+  s21_softmax_n(v, v, 3);
+  ck_assert_double_eq_tol(v[1], 1 / (1 + exp(-1) + exp(-2)), 1e-15);
+  s21_softmax_n(y, out, 3);
+  ck_assert_double_nan(out[0]);
+}
+END_TEST
+
+Suite* test_activation(void) {
+  Suite* s24;
+  TCase* tc24;
+  s24 = suite_create("s21_activation");
+  tc24 = tcase_create("case_activation");
+
+  tcase_add_test(tc24, activation_1);
+  tcase_add_test(tc24, activation_2);
+  tcase_add_test(tc24, activation_3);
+
+  suite_add_tcase(s24, tc24);
+  return s24;
+}
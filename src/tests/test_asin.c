@@ -127,6 +127,40 @@ START_TEST(asin_20) {
 }
 END_TEST
 
+START_TEST(asin_21) {
+  for (double x = -1; x <= 1; x += 0.0000613) {
+    long double want = asinl(x);
+    ck_assert_ldouble_le(fabsl(s21_asin(x) - want),
+                         fabsl(want) * 0x1.1p-52L);
+  }
+  ck_assert_ldouble_eq(s21_asin(1), 0x1.921fb54442d18p+0);
+  ck_assert_ldouble_eq(s21_asin(-1), -0x1.921fb54442d18p+0);
+  ck_assert(signbit((double)s21_asin(-0.0)));
+  ck_assert_ldouble_eq(s21_asin(1e-300), 1e-300);
+}
+END_TEST
+
+START_TEST(asin_22) {
+  double in[100], out[100];
+  for (int i = 0; i < 100; i++) in[i] = (i - 50) * 0.0213;
+  in[3] = NAN;
+  in[4] = INFINITY;
+  s21_asin_n(in, out, 100);
+  for (int i = 0; i < 100; i++) {
+    long double want = s21_asin(in[i]);
+    if (isnan(want)) {
+      ck_assert_double_nan(out[i]);
+    } else {
+      ck_assert_double_eq(out[i], want);
+    }
+  }
+  ck_assert_double_nan(out[3]);
+  ck_assert_double_nan(out[99]);
+  s21_asin_n(in, in, 100);
+  ck_assert_double_eq(in[60], out[60]);
+}
+END_TEST
+
 Suite* test_asin(void) {
   Suite* s3;
   TCase* tc3;
@@ -153,6 +187,8 @@ Suite* test_asin(void) {
   tcase_add_test(tc3, asin_18);
   tcase_add_test(tc3, asin_19);
   tcase_add_test(tc3, asin_20);
+  tcase_add_test(tc3, asin_21);
+  tcase_add_test(tc3, asin_22);
 
   suite_add_tcase(s3, tc3);
   return s3;
@@ -0,0 +1,85 @@
+#include "tests.h"
+
+START_TEST(atan2_hypot_1) {
+  for (double a = -7; a < 7; a += 0.173) {
+    double y = sin(a) * 3.5, x = cos(a) * 3.5;
+    ck_assert_ldouble_eq_tol(s21_atan2(y, x), atan2(y, x), 1e-15);
+    ck_assert_ldouble_eq_tol(s21_hypot(x, y), 3.5, 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(atan2_hypot_2) {
+  double v[] = {0, -0.0, 1, -1, 1e-320, INFINITY, -INFINITY};
+  for (int i = 0; i < 7; i++) {
+    for (int j = 0; j < 7; j++) {
+      long double our = s21_atan2(v[i], v[j]);
+      double orig = atan2(v[i], v[j]);
+      ck_assert_ldouble_eq_tol(our, orig, 1e-15);
+      ck_assert_int_eq(!!signbit(our), !!signbit(orig));
+    }
+  }
+  ck_assert_ldouble_nan(s21_atan2(NAN, 1));
+  ck_assert_ldouble_nan(s21_atan2(0, NAN));
+}
+END_TEST
+
+START_TEST(atan2_hypot_3) {
+  ck_assert_ldouble_eq_tol(s21_hypot(3e300, 4e300) / 5e300, 1, 1e-15);
+  ck_assert_ldouble_eq_tol(s21_hypot(3e-300, 4e-300) / 5e-300, 1, 1e-15);
+  ck_assert_ldouble_eq(s21_hypot(5e-324, 0), 5e-324);
+  ck_assert_ldouble_eq(s21_hypot(-0.0, 0), 0);
+  ck_assert_ldouble_infinite(s21_hypot(NAN, -INFINITY));
+  ck_assert_ldouble_nan(s21_hypot(NAN, 1));
+}
+END_TEST
+
+START_TEST(atan2_hypot_4) {
+  for (double x = -50; x < 50; x += 0.77) {
+    ck_assert_ldouble_eq_tol(s21_atan(x), atan(x), 1e-15);
+  }
+  ck_assert_ldouble_eq(s21_atan(-0.0), 0);
+  ck_assert_int_eq(!!signbit(s21_atan(-0.0)), 1);
+}
+END_TEST
+
+START_TEST(atan2_hypot_5) {
+  double y[] = {1, -1, 0, 1e300, -2, INFINITY, NAN, 0.5};
+  double x[] = {1, -1, -1, 1e-300, 0, -INFINITY, 1, 1e300};
+  double out[8];
+  s21_atan2_n(y, x, out, 8);
+  for (int i = 0; i < 8; i++) {
+    if (isnan(y[i])) {
+      ck_assert_double_nan(out[i]);
+    } else {
+      ck_assert_double_eq_tol(out[i], atan2(y[i], x[i]), 1e-15);
+    }
+  }
+  s21_hypot_n(x, y, out, 8);
+  for (int i = 0; i < 5; i++) {
+    ck_assert_double_eq_tol(out[i], hypot(x[i], y[i]),
+                            hypot(x[i], y[i]) * 1e-15);
+  }
+  ck_assert_double_infinite(out[5]);
+  s21_atan_n(x, out, 8);
+  for (int i = 0; i < 8; i++) {
+    ck_assert_double_eq_tol(out[i], atan(x[i]), 1e-15);
+  }
+}
+END_TEST
+
+Suite* test_atan2_hypot(void) {
+  Suite* s21;
+  TCase* tc21;
+  s21 = suite_create("s21_atan2_hypot");
+  tc21 = tcase_create("case_atan2_hypot");
+
+  tcase_add_test(tc21, atan2_hypot_1);
+  tcase_add_test(tc21, atan2_hypot_2);
+  tcase_add_test(tc21, atan2_hypot_3);
+  tcase_add_test(tc21, atan2_hypot_4);
+  tcase_add_test(tc21, atan2_hypot_5);
+
+  suite_add_tcase(s21, tc21);
+  return s21;
+}
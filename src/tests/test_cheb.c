@@ -0,0 +1,64 @@
+#include "tests.h"
+
+static double composite(double x) { return exp(-x * x) * cos(x); }
+
+static double kink(double x) { return fabs(x - 0.3); }
+
+START_TEST(cheb_1) {
+  s21_cheb *ch = s21_cheb_build(composite, -3, 3, 1e-12);
+  ck_assert_ptr_nonnull(ch);
+  ck_assert_double_le(ch->err, 1e-12);
+  for (double x = -3; x <= 3; x += 0.00071) {
+    ck_assert_ldouble_eq_tol(s21_cheb_eval(ch, x), composite(x), 1e-12);
+  }
+  ck_assert_ldouble_eq_tol(s21_cheb_eval(ch, 3), composite(3), 1e-12);
+  ck_assert_ldouble_nan(s21_cheb_eval(ch, 3.01));
+  ck_assert_ldouble_nan(s21_cheb_eval(ch, NAN));
+  s21_cheb_free(ch);
+}
+END_TEST
+
+START_TEST(cheb_2) {
+  s21_cheb *ch = s21_cheb_build(sin, 0, 100, 1e-13);
+  ck_assert_ptr_nonnull(ch);
+  double in[300], out[300];
+  for (int i = 0; i < 300; i++) in[i] = i / 2.99;
+  in[7] = -1;
+  s21_cheb_eval_n(ch, in, out, 300);
+  ck_assert_double_nan(out[7]);
+  for (int i = 8; i < 300; i++) {
+    ck_assert_double_eq_tol(out[i], sin(in[i]), 1e-13);
+  }
+  s21_cheb_eval_n(ch, in, in, 300);
+  for (int i = 8; i < 300; i++) ck_assert_double_eq(in[i], out[i]);
+  s21_cheb_free(ch);
+}
+END_TEST
+
+START_TEST(cheb_3) {
+  s21_cheb *ch = s21_cheb_build(exp, 0, 1, 1e-3);
+  ck_assert_ptr_nonnull(ch);
+  ck_assert_int_eq(ch->segs, 1);
+  ck_assert_int_lt(ch->stride, 8);
+  s21_cheb_free(ch);
+  ck_assert_ptr_null(s21_cheb_build(kink, -1, 1, 1e-9));
+  ck_assert_ptr_null(s21_cheb_build(exp, 1, 1, 1e-9));
+  ck_assert_ptr_null(s21_cheb_build(exp, 0, 1, 0));
+  ck_assert_ptr_null(s21_cheb_build(NULL, 0, 1, 1e-9));
+  s21_cheb_free(NULL);
+}
+END_TEST
+
+Suite* test_cheb(void) {
+  Suite* s26;
+  TCase* tc26;
+  s26 = suite_create("s21_cheb");
+  tc26 = tcase_create("case_cheb");
+
+  tcase_add_test(tc26, cheb_1);
+  tcase_add_test(tc26, cheb_2);
+  tcase_add_test(tc26, cheb_3);
+
+  suite_add_tcase(s26, tc26);
+  return s26;
+}
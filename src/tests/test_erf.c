@@ -0,0 +1,79 @@
+#include "tests.h"
+
+/* relative error against libm; erfc goes subnormal from about 26.5 on */
+static void check_close(double got, double want) {
+  if (isnan(want)) {
+    ck_assert_double_nan(got);
+  } else {
+    ck_assert_double_eq_tol(got, want, 1e-15 * fabs(want) + 1e-320);
+  }
+}
+
+START_TEST(erf_1) {
+  for (double x = -6.5; x < 28; x += 0.00917) {
+    check_close(s21_erf(x), erf(x));
+    check_close(s21_erfc(x), erfc(x));
+  }
+  double xs[] = {0.0,  -0.0, 1e-310, -1e-300, 0.5, -0.5, 0.49999999999999994,
+                 31.9, 32,   1e300,  -1e300,  INFINITY, -INFINITY, NAN};
+  for (int i = 0; i < 14; i++) {
+    check_close(s21_erf(xs[i]), erf(xs[i]));
+    check_close(s21_erfc(xs[i]), erfc(xs[i]));
+  }
+  double z = s21_erf(-0.0);
+  ck_assert(signbit(z));
+  ck_assert_double_eq(s21_erfc(-40), 2);
+  ck_assert_double_eq(s21_erf(6), 1);
+}
+END_TEST
+
+START_TEST(erf_2) {
+  /* 203 elements leave a tail after the vector loop and span blocks */
+  double in[203], out[203], copy[203];
+  for (int i = 0; i < 203; i++) in[i] = (i - 101) * 0.29 + i * 1e-3;
+  in[5] = NAN;
+  in[6] = INFINITY;
+  in[7] = -INFINITY;
+  in[8] = -0.0;
+  for (int f = 0; f < 2; f++) {
+    void (*batch)(const double *, double *, size_t) =
+        f ? s21_erfc_n : s21_erf_n;
+    long double (*scalar)(double) = f ? s21_erfc : s21_erf;
+    batch(in, out, 203);
+    for (int i = 0; i < 203; i++) {
+      double want = scalar(in[i]);
+      ck_assert_int_eq(memcmp(&out[i], &want, sizeof(want)), 0);
+    }
+    memcpy(copy, in, sizeof(in));
+    batch(copy, copy, 203);
+    ck_assert_int_eq(memcmp(copy, out, sizeof(out)), 0);
+  }
+}
+END_TEST
+
+START_TEST(erf_3) {
+  /* normal CDF: Phi(x) = erfc(-x / sqrt(2)) / 2 keeps the lower tail */
+  double in[4] = {-1.959963984540054, -8, -37, 0}, out[4];
+  for (int i = 0; i < 4; i++) in[i] /= -sqrt(2);
+  s21_erfc_n(in, out, 4);
+  ck_assert_double_eq_tol(out[0] / 2, 0.025, 1e-15);
+  /* the rounding of x / sqrt(2) is amplified about x^2 times */
+  ck_assert_double_eq_tol(out[1] / 2, 6.220960574271819e-16, 1e-28);
+  ck_assert_double_eq_tol(out[2] / 2, 5.725571222525139e-300, 1e-311);
+  ck_assert_double_eq(out[3], 1);
+}
+END_TEST
+
+Suite* test_erf(void) {
+  Suite* s33;
+  TCase* tc33;
+  s33 = suite_create("s21_erf");
+  tc33 = tcase_create("case_erf");
+
+  tcase_add_test(tc33, erf_1);
+  tcase_add_test(tc33, erf_2);
+  tcase_add_test(tc33, erf_3);
+
+  suite_add_tcase(s33, tc33);
+  return s33;
+}
@@ -0,0 +1,87 @@
+#include "tests.h"
+
+/* infinities and exact zeros must match exactly, since inf - inf is NaN
+   and a zero tolerance admits nothing; the rest to a relative tolerance,
+   floored for subnormals where it would underflow */
+static void check_rel(double got, double want, double rel) {
+  if (isinf(want)) {
+    ck_assert_double_infinite(got);
+    ck_assert_int_eq(signbit(got) != 0, signbit(want) != 0);
+  } else if (want == 0) {
+    ck_assert_double_eq(got, want);
+  } else {
+    ck_assert_double_eq_tol(got, want, fmax(fabs(want) * rel, 1e-320));
+  }
+}
+
+START_TEST(exp_family_1) {
+  for (double x = -30; x < 30; x += 0.37) {
+    ck_assert_ldouble_eq_tol(s21_exp2(x) / exp2(x), 1, 1e-15);
+    ck_assert_ldouble_eq_tol(s21_exp(x) / exp(x), 1, 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(exp_family_2) {
+  for (double x = -300; x < 300; x += 7.13) {
+    ck_assert_ldouble_eq_tol(s21_exp10(x) / pow(10, x), 1, 1e-14);
+  }
+  ck_assert_ldouble_eq(s21_exp10(2), 100);
+  ck_assert_ldouble_eq(s21_exp2(-3), 0.125);
+}
+END_TEST
+
+START_TEST(exp_family_3) {
+  for (double x = 1e-300; x < 50; x *= 3.1) {
+    ck_assert_ldouble_eq_tol(s21_expm1(x) / expm1(x), 1, 1e-15);
+    ck_assert_ldouble_eq_tol(s21_expm1(-x) / expm1(-x), 1, 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(exp_family_4) {
+  ck_assert_ldouble_nan(s21_exp2(NAN));
+  ck_assert_ldouble_nan(s21_exp10(NAN));
+  ck_assert_ldouble_nan(s21_expm1(NAN));
+  ck_assert_ldouble_infinite(s21_exp2(1024));
+  ck_assert_ldouble_infinite(s21_exp10(INFINITY));
+  ck_assert_ldouble_infinite(s21_expm1(710));
+  ck_assert_ldouble_eq(s21_exp2(-INFINITY), 0);
+  ck_assert_ldouble_eq(s21_exp10(-400), 0);
+  ck_assert_ldouble_eq(s21_expm1(-INFINITY), -1);
+  ck_assert_ldouble_eq(s21_exp2(-1074), exp2(-1074));
+}
+END_TEST
+
+START_TEST(exp_family_5) {
+  double in[] = {-800, -745, -1.5, -1e-10, 0, 0.3, 1, 88.5, 709.7, 710, NAN};
+  double out[11];
+  s21_exp_n(in, out, 11);
+  for (int i = 0; i < 10; i++) check_rel(out[i], exp(in[i]), 1e-15);
+  ck_assert_double_nan(out[10]);
+  s21_expm1_n(in, out, 11);
+  for (int i = 0; i < 10; i++) check_rel(out[i], expm1(in[i]), 1e-15);
+  s21_exp2_n(in, out, 11);
+  for (int i = 0; i < 10; i++) check_rel(out[i], exp2(in[i]), 1e-15);
+  s21_exp10_n(in, in, 11);
+  ck_assert_double_eq(in[0], 0);
+  ck_assert_double_eq(in[4], 1);
+  ck_assert_double_eq(in[6], 10);
+}
+END_TEST
+
+Suite* test_exp_family(void) {
+  Suite* s19;
+  TCase* tc19;
+  s19 = suite_create("s21_exp_family");
+  tc19 = tcase_create("case_exp_family");
+
+  tcase_add_test(tc19, exp_family_1);
+  tcase_add_test(tc19, exp_family_2);
+  tcase_add_test(tc19, exp_family_3);
+  tcase_add_test(tc19, exp_family_4);
+  tcase_add_test(tc19, exp_family_5);
+
+  suite_add_tcase(s19, tc19);
+  return s19;
+}
@@ -171,6 +171,75 @@ START_TEST(s21_fmod_test_27) {
 }
 END_TEST
 
+START_TEST(s21_fmod_test_28) {
+  /* fmod is exact, so the batch has to match libm bit for bit */
+  double ys[] = {2 * s21_PI, 1.0, -3.0, 0.1, 1e-300, 0x1p-1070, 1e300, 7e-5};
+  double in[300], out[300];
+  for (int k = 0; k < 8; k++) {
+    s21_fmod_divisor d = s21_fmod_prepare(ys[k]);
+    for (int i = 0; i < 300; i++) {
+      in[i] = (i - 150) * 1.37e-2 * pow(1.21, i % 97) + i * 1e-9;
+    }
+    in[5] = 0.0;
+    in[6] = -0.0;
+    in[7] = 6 * ys[k];
+    in[8] = -5 * ys[k];
+    in[9] = ys[k] * 0x1p45;
+    in[10] = 1e308;
+    in[11] = 0x1p-1074;
+    s21_fmod_n_fixed(&d, in, out, 300);
+    for (int i = 0; i < 300; i++) {
+      double want = fmod(in[i], ys[k]);
+      if (isnan(want)) {
+        ck_assert_double_nan(out[i]);
+      } else {
+        ck_assert_int_eq(memcmp(&out[i], &want, sizeof(want)), 0);
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(s21_fmod_test_29) {
+  /* quotients next to integers, where the reciprocal is off by one */
+  double y = 0.1, in[64], out[64];
+  s21_fmod_divisor d = s21_fmod_prepare(y);
+  for (int i = 0; i < 64; i++) {
+    in[i] = nextafter((i + 1) * y, i % 2 ? 0 : 1e9);
+  }
+  s21_fmod_n_fixed(&d, in, in, 64);
+  for (int i = 0; i < 64; i++) {
+    double x = nextafter((i + 1) * y, i % 2 ? 0 : 1e9);
+    out[i] = fmod(x, y);
+    ck_assert_int_eq(memcmp(&in[i], &out[i], sizeof(double)), 0);
+  }
+}
+END_TEST
+
+START_TEST(s21_fmod_test_30) {
+  double in[] = {INFINITY, NAN, 3.5, -0.0, 1e300};
+  double out[5];
+  s21_fmod_divisor d = s21_fmod_prepare(0.0);
+  s21_fmod_n_fixed(&d, in, out, 5);
+  for (int i = 0; i < 5; i++) ck_assert_double_nan(out[i]);
+  d = s21_fmod_prepare(-INFINITY);
+  s21_fmod_n_fixed(&d, in, out, 5);
+  ck_assert_double_nan(out[0]);
+  ck_assert_double_nan(out[1]);
+  ck_assert_double_eq(out[2], 3.5);
+  ck_assert(signbit(out[3]));
+  ck_assert_double_eq(out[4], 1e300);
+  d = s21_fmod_prepare(NAN);
+  s21_fmod_n_fixed(&d, in, out, 5);
+  for (int i = 0; i < 5; i++) ck_assert_double_nan(out[i]);
+  d = s21_fmod_prepare(2.0);
+  s21_fmod_n_fixed(&d, in, out, 5);
+  ck_assert_double_nan(out[0]);
+  ck_assert_double_nan(out[1]);
+  ck_assert_double_eq(out[2], 1.5);
+}
+END_TEST
+
 Suite* test_fmod(void) {
   Suite* s10;
   TCase* tc10;
@@ -205,6 +274,9 @@ Suite* test_fmod(void) {
   tcase_add_test(tc10, s21_fmod_test_25);
   tcase_add_test(tc10, s21_fmod_test_26);
   tcase_add_test(tc10, s21_fmod_test_27);
+  tcase_add_test(tc10, s21_fmod_test_28);
+  tcase_add_test(tc10, s21_fmod_test_29);
+  tcase_add_test(tc10, s21_fmod_test_30);
 
   suite_add_tcase(s10, tc10);
   return s10;
@@ -0,0 +1,140 @@
+#include "tests.h"
+
+/* relative error against libm, absolute where the result is small */
+static void check_close(double got, double want) {
+  if (isnan(want)) {
+    ck_assert_double_nan(got);
+  } else if (isinf(want)) {
+    ck_assert_double_eq(got, want);
+  } else {
+    ck_assert_double_eq_tol(got, want, 1e-14 * fmax(1, fabs(want)));
+  }
+}
+
+START_TEST(gamma_1) {
+  for (double x = -170.3; x < 171.6; x += 0.0917) {
+    check_close(s21_tgamma(x), tgamma(x));
+    check_close(s21_lgamma(x), lgamma(x));
+  }
+  double xs[] = {1e-300, -1e-300, 1e-10, 0.5, -0.5, 2.5, 9.999, 10.001,
+                 171.62, 1e10, 1e300, -2.457024738220800};
+  for (int i = 0; i < 12; i++) {
+    check_close(s21_tgamma(xs[i]), tgamma(xs[i]));
+    check_close(s21_lgamma(xs[i]), lgamma(xs[i]));
+  }
+  ck_assert_double_eq_tol(s21_tgamma(0.5), sqrt(s21_PI), 1e-15);
+  ck_assert_double_eq(s21_lgamma(1), 0);
+  ck_assert_double_eq(s21_lgamma(2), 0);
+}
+END_TEST
+
+START_TEST(gamma_2) {
+  errno = 0;
+  ck_assert_double_eq(s21_tgamma(0.0), INFINITY);
+  ck_assert_int_eq(errno, ERANGE);
+  ck_assert_double_eq(s21_tgamma(-0.0), -INFINITY);
+  errno = 0;
+  ck_assert_double_nan(s21_tgamma(-3));
+  ck_assert_int_eq(errno, EDOM);
+  ck_assert_double_nan(s21_tgamma(-1e300));
+  ck_assert_double_nan(s21_tgamma(-INFINITY));
+  ck_assert_double_nan(s21_tgamma(NAN));
+  ck_assert_double_eq(s21_tgamma(INFINITY), INFINITY);
+  ck_assert_double_eq(s21_tgamma(172), INFINITY);
+  ck_assert_double_eq(s21_tgamma(-200.5), 0);
+
+  ck_assert_double_eq(s21_lgamma(0.0), INFINITY);
+  ck_assert_double_eq(s21_lgamma(-4), INFINITY);
+  ck_assert_double_eq(s21_lgamma(INFINITY), INFINITY);
+  ck_assert_double_eq(s21_lgamma(-INFINITY), INFINITY);
+  ck_assert_double_nan(s21_lgamma(NAN));
+}
+END_TEST
+
+START_TEST(gamma_3) {
+  double f = 1;
+  for (int n = 0; n <= 170; n++) {
+    if (n > 0) f *= n;
+    if (n <= 22) ck_assert_double_eq(s21_factorial(n), f);
+    ck_assert_double_eq(s21_factorial(n), s21_tgamma(n + 1));
+  }
+  ck_assert_ldouble_infinite(s21_factorial(171));
+  ck_assert_ldouble_nan(s21_factorial(-1));
+}
+END_TEST
+
+START_TEST(gamma_4) {
+  double in[150], out[150], copy[150];
+  for (int i = 0; i < 150; i++) in[i] = i * 1.37 - 60.2;
+  in[7] = -3;
+  in[8] = NAN;
+  for (int f = 0; f < 2; f++) {
+    void (*batch)(const double *, double *, size_t) =
+        f ? s21_lgamma_n : s21_tgamma_n;
+    long double (*scalar)(double) = f ? s21_lgamma : s21_tgamma;
+    batch(in, out, 150);
+    for (int i = 0; i < 150; i++) {
+      double want = scalar(in[i]);
+      ck_assert_int_eq(memcmp(&out[i], &want, sizeof(want)), 0);
+    }
+    memcpy(copy, in, sizeof(in));
+    batch(copy, copy, 150);
+    ck_assert_int_eq(memcmp(copy, out, sizeof(out)), 0);
+  }
+}
+END_TEST
+
+START_TEST(gamma_5) {
+  /* log C(n, k) = lgamma(n + 1) - lgamma(k + 1) - lgamma(n - k + 1) */
+  double args[3 * 61], lg[3 * 61];
+  for (int k = 0; k <= 60; k++) {
+    args[3 * k] = 61;
+    args[3 * k + 1] = k + 1;
+    args[3 * k + 2] = 61 - k;
+  }
+  s21_lgamma_n(args, lg, 3 * 61);
+  double c = 1;
+  for (int k = 0; k <= 60; k++) {
+    double lbinom = lg[3 * k] - lg[3 * k + 1] - lg[3 * k + 2];
+    ck_assert_double_eq_tol(lbinom, log(c), 1e-12);
+    c = c * (60 - k) / (k + 1);
+  }
+}
+END_TEST
+
+START_TEST(gamma_6) {
+  /* relative accuracy where lgamma crosses zero: at 1 and 2, and at the
+     zeros in (-3, -2), approached to within a few ulp */
+  double zeros[] = {1, 2, -2.457024738220800, -2.747682646727412};
+  for (int i = 0; i < 4; i++) {
+    double lo = zeros[i], hi = zeros[i];
+    for (int k = 0; k < 200; k++) {
+      lo = nextafter(lo, -INFINITY);
+      hi = nextafter(hi, INFINITY);
+      double xs[] = {lo, hi, zeros[i] - k * 1e-4, zeros[i] + k * 1e-4};
+      for (int j = 0; j < 4; j++) {
+        double want = lgamma(xs[j]);
+        if (want == 0) continue;
+        ck_assert_double_eq_tol(s21_lgamma(xs[j]), want, fabs(want) * 1e-15);
+      }
+    }
+  }
+}
+END_TEST
+
+Suite* test_gamma(void) {
+  Suite* s32;
+  TCase* tc32;
+  s32 = suite_create("s21_gamma");
+  tc32 = tcase_create("case_gamma");
+
+  tcase_add_test(tc32, gamma_1);
+  tcase_add_test(tc32, gamma_2);
+  tcase_add_test(tc32, gamma_3);
+  tcase_add_test(tc32, gamma_4);
+  tcase_add_test(tc32, gamma_5);
+  tcase_add_test(tc32, gamma_6);
+
+  suite_add_tcase(s32, tc32);
+  return s32;
+}
@@ -0,0 +1,70 @@
+#include "tests.h"
+
+START_TEST(hyperbolic_1) {
+  for (double x = -25; x < 25; x += 0.0917) {
+    ck_assert_ldouble_eq_tol(s21_sinh(x) / sinh(x), 1, 1e-15);
+    ck_assert_ldouble_eq_tol(s21_cosh(x) / cosh(x), 1, 1e-15);
+    ck_assert_ldouble_eq_tol(s21_tanh(x), tanh(x), 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(hyperbolic_2) {
+  double v[] = {1e-300, -1e-8, 3e-5, 0.125, -0.5};
+  for (int i = 0; i < 5; i++) {
+    ck_assert_ldouble_eq_tol(s21_sinh(v[i]) / sinh(v[i]), 1, 1e-15);
+    ck_assert_ldouble_eq_tol(s21_tanh(v[i]) / tanh(v[i]), 1, 1e-15);
+  }
+  ck_assert_int_eq(!!signbit(s21_sinh(-0.0)), 1);
+  ck_assert_int_eq(!!signbit(s21_tanh(-0.0)), 1);
+  ck_assert_ldouble_eq(s21_cosh(-0.0), 1);
+}
+END_TEST
+
+START_TEST(hyperbolic_3) {
+  ck_assert_ldouble_eq_tol(s21_sinh(710.4) / sinh(710.4), 1, 1e-15);
+  ck_assert_ldouble_eq_tol(s21_cosh(-710.4) / cosh(-710.4), 1, 1e-15);
+  ck_assert_ldouble_infinite(s21_sinh(710.5));
+  ck_assert_ldouble_infinite(s21_cosh(1e10));
+  ck_assert_ldouble_eq(s21_sinh(-INFINITY), -INFINITY);
+  ck_assert_ldouble_eq(s21_cosh(-INFINITY), INFINITY);
+  ck_assert_ldouble_eq(s21_tanh(-INFINITY), -1);
+  ck_assert_ldouble_eq(s21_tanh(40), 1);
+  ck_assert_ldouble_nan(s21_sinh(NAN));
+  ck_assert_ldouble_nan(s21_cosh(NAN));
+  ck_assert_ldouble_nan(s21_tanh(NAN));
+}
+END_TEST
+
+START_TEST(hyperbolic_4) {
+  double in[64], out[64];
+  for (int i = 0; i < 64; i++) in[i] = (i - 32) * 0.7;
+  s21_sinh_n(in, out, 64);
+  for (int i = 0; i < 64; i++) {
+    ck_assert_double_eq_tol(out[i], sinh(in[i]), 1e-15 * cosh(in[i]));
+  }
+  s21_cosh_n(in, out, 64);
+  for (int i = 0; i < 64; i++) {
+    ck_assert_double_eq_tol(out[i] / cosh(in[i]), 1, 1e-15);
+  }
+  s21_tanh_n(in, out, 64);
+  for (int i = 0; i < 64; i++) {
+    ck_assert_double_eq_tol(out[i], tanh(in[i]), 1e-15);
+  }
+}
+END_TEST
+
+Suite* test_hyperbolic(void) {
+  Suite* s23;
+  TCase* tc23;
+  s23 = suite_create("s21_hyperbolic");
+  tc23 = tcase_create("case_hyperbolic");
+
+  tcase_add_test(tc23, hyperbolic_1);
+  tcase_add_test(tc23, hyperbolic_2);
+  tcase_add_test(tc23, hyperbolic_3);
+  tcase_add_test(tc23, hyperbolic_4);
+
+  suite_add_tcase(s23, tc23);
+  return s23;
+}
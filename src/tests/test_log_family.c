@@ -0,0 +1,118 @@
+#include "tests.h"
+
+START_TEST(log_family_1) {
+  for (double x = 1e-310; x < 1e300; x *= 7.3) {
+    ck_assert_ldouble_eq_tol(s21_log(x), log(x), fabs(log(x)) * 1e-15);
+    ck_assert_ldouble_eq_tol(s21_log2(x), log2(x), fabs(log2(x)) * 1e-15);
+    ck_assert_ldouble_eq_tol(s21_log10(x), log10(x), fabs(log10(x)) * 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(log_family_2) {
+  for (int k = -1074; k < 1024; k++) {
+    ck_assert_ldouble_eq(s21_log2(ldexp(1, k)), k);
+  }
+  ck_assert_ldouble_eq_tol(s21_log10(1000), 3, 1e-15);
+}
+END_TEST
+
+START_TEST(log_family_3) {
+  for (double x = 1e-300; x < 1e300; x *= 5.1) {
+    ck_assert_ldouble_eq_tol(s21_log1p(x), log1p(x), log1p(x) * 1e-15);
+    if (x < 1) {
+      ck_assert_ldouble_eq_tol(s21_log1p(-x), log1p(-x), -log1p(-x) * 1e-15);
+    }
+  }
+}
+END_TEST
+
+START_TEST(log_family_4) {
+  ck_assert_ldouble_nan(s21_log2(-1));
+  ck_assert_ldouble_nan(s21_log10(NAN));
+  ck_assert_ldouble_nan(s21_log1p(-2));
+  ck_assert_ldouble_infinite(s21_log2(0));
+  ck_assert_ldouble_infinite(s21_log10(INFINITY));
+  ck_assert_ldouble_infinite(s21_log1p(-1));
+  ck_assert_ldouble_eq(s21_log1p(0), 0);
+  ck_assert_ldouble_eq(s21_log10(1), 0);
+}
+END_TEST
+
+START_TEST(log_family_5) {
+  double in[] = {0, -1, 1e-320, 1e-5, 0.7, 1, 1.5, 2, 1e10, INFINITY, NAN};
+  double out[11];
+  s21_log_n(in, out, 11);
+  for (int i = 0; i < 11; i++) {
+    if (isnan(log(in[i]))) {
+      ck_assert_double_nan(out[i]);
+    } else if (isinf(log(in[i]))) {
+      /* a tolerance cannot compare infinities, inf - inf is NaN */
+      ck_assert_double_infinite(out[i]);
+      ck_assert_int_eq(out[i] > 0, log(in[i]) > 0);
+    } else {
+      ck_assert_double_eq_tol(out[i], log(in[i]), 1e-12);
+    }
+  }
+  s21_log2_n(in, out, 11);
+  ck_assert_double_eq(out[7], 1);
+  s21_log10_n(in, out, 11);
+  ck_assert_double_eq_tol(out[8], 10, 1e-14);
+  s21_log1p_n(in, in, 11);
+  ck_assert_double_eq(in[0], 0);
+  ck_assert_double_infinite(in[1]);
+  ck_assert_double_eq_tol(in[3], log1p(1e-5), 1e-20);
+}
+END_TEST
+
+START_TEST(log_family_6) {
+  ck_assert_int_eq(s21_ilog2(0), -1);
+  ck_assert_int_eq(s21_ilog2(1), 0);
+  ck_assert_int_eq(s21_ilog2(UINT64_MAX), 63);
+  ck_assert_int_eq(s21_ilog10(0), -1);
+  ck_assert_int_eq(s21_ilog10(UINT64_MAX), 19);
+  uint64_t p = 1;
+  for (int k = 0; k < 20; k++, p *= 10) {
+    ck_assert_int_eq(s21_ilog10(p), k);
+    ck_assert_int_eq(s21_ilog10(p - 1), k - 1);
+  }
+  for (int k = 0; k < 64; k++) {
+    ck_assert_int_eq(s21_ilog2(1ULL << k), k);
+    ck_assert_int_eq(s21_ilog2((1ULL << k) - 1), k - 1);
+  }
+}
+END_TEST
+
+START_TEST(log_family_7) {
+  uint64_t in[100];
+  int lg2[100], lg10[100];
+  for (int i = 0; i < 100; i++) in[i] = 0x9e3779b97f4a7c15ULL >> (i % 64);
+  in[0] = 0;
+  s21_ilog2_n(in, lg2, 100);
+  s21_ilog10_n(in, lg10, 100);
+  for (int i = 0; i < 100; i++) {
+    int digits = 0;
+    for (uint64_t v = in[i]; v; v /= 10) digits++;
+    ck_assert_int_eq(lg2[i], s21_ilog2(in[i]));
+    ck_assert_int_eq(lg10[i], digits - 1);
+  }
+}
+END_TEST
+
+Suite* test_log_family(void) {
+  Suite* s20;
+  TCase* tc20;
+  s20 = suite_create("s21_log_family");
+  tc20 = tcase_create("case_log_family");
+
+  tcase_add_test(tc20, log_family_1);
+  tcase_add_test(tc20, log_family_2);
+  tcase_add_test(tc20, log_family_3);
+  tcase_add_test(tc20, log_family_4);
+  tcase_add_test(tc20, log_family_5);
+  tcase_add_test(tc20, log_family_6);
+  tcase_add_test(tc20, log_family_7);
+
+  suite_add_tcase(s20, tc20);
+  return s20;
+}
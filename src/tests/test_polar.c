@@ -0,0 +1,99 @@
+#include "tests.h"
+
+START_TEST(polar_1) {
+  for (double x = -30; x < 30; x += 0.0731) {
+    long double s, c;
+    s21_sincos(x, &s, &c);
+    ck_assert_ldouble_eq_tol(s, sin(x), 1e-15);
+    ck_assert_ldouble_eq_tol(c, cos(x), 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(polar_2) {
+  double v[] = {1e300, -1e22, 0x1p1023, 1048576.5, -3e6, 1e-310};
+  for (int i = 0; i < 6; i++) {
+    long double s, c;
+    s21_sincos(v[i], &s, &c);
+    ck_assert_ldouble_eq_tol(s, sin(v[i]), 1e-15);
+    ck_assert_ldouble_eq_tol(c, cos(v[i]), 1e-15);
+  }
+  long double s, c;
+  s21_sincos(-0.0, &s, &c);
+  ck_assert_int_eq(!!signbit(s), 1);
+  ck_assert_ldouble_eq(c, 1);
+  s21_sincos(INFINITY, &s, &c);
+  ck_assert_ldouble_nan(s);
+  ck_assert_ldouble_nan(c);
+}
+END_TEST
+
+START_TEST(polar_3) {
+  double in[100], s[100], c[100];
+  for (int i = 0; i < 100; i++) in[i] = (i - 50) * 0.61;
+  in[77] = 1e200;
+  s21_sincos_n(in, s, c, 100);
+  for (int i = 0; i < 100; i++) {
+    ck_assert_double_eq_tol(s[i], sin(in[i]), 1e-15);
+    ck_assert_double_eq_tol(c[i], cos(in[i]), 1e-15);
+  }
+  s21_sincos_n(in, in, c, 100);
+  ck_assert_double_eq_tol(in[77], sin(1e200), 1e-15);
+}
+END_TEST
+
+START_TEST(polar_4) {
+  double x[70], y[70], r[70], t[70];
+  for (int i = 0; i < 70; i++) {
+    x[i] = (i - 35) * 0.3;
+    y[i] = (i % 9 - 4) * 1.7;
+  }
+  y[5] = INFINITY;
+  s21_cart2polar_n(x, y, r, t, 70);
+  for (int i = 0; i < 70; i++) {
+    /* inf - inf is NaN, so the infinite radius is checked on its own */
+    if (i == 5) {
+      ck_assert_double_infinite(r[i]);
+    } else {
+      ck_assert_double_eq_tol(r[i], hypot(x[i], y[i]), 1e-14);
+    }
+    ck_assert_double_eq_tol(t[i], atan2(y[i], x[i]), 1e-15);
+  }
+}
+END_TEST
+
+START_TEST(polar_5) {
+  double r[70], t[70], x[70], y[70];
+  for (int i = 0; i < 70; i++) {
+    r[i] = i * 0.25;
+    t[i] = (i - 35) * 0.2;
+  }
+  t[66] = 1e100;
+  s21_polar2cart_n(r, t, x, y, 70);
+  for (int i = 0; i < 70; i++) {
+    ck_assert_double_eq_tol(x[i], r[i] * cos(t[i]), 1e-14);
+    ck_assert_double_eq_tol(y[i], r[i] * sin(t[i]), 1e-14);
+  }
+  s21_cart2polar_n(x, y, x, y, 70);
+  for (int i = 20; i < 50; i++) {
+    ck_assert_double_eq_tol(x[i], r[i], 1e-13);
+    ck_assert_double_eq_tol(y[i], t[i], 1e-14);
+  }
+}
+END_TEST
+
+Suite* test_polar(void) {
+  Suite* s22;
+  TCase* tc22;
+  s22 = suite_create("s21_polar");
+  tc22 = tcase_create("case_polar");
+
+  tcase_add_test(tc22, polar_1);
+  tcase_add_test(tc22, polar_2);
+  tcase_add_test(tc22, polar_3);
+  tcase_add_test(tc22, polar_4);
+  tcase_add_test(tc22, polar_5);
+
+  suite_add_tcase(s22, tc22);
+  return s22;
+}
@@ -0,0 +1,67 @@
+#include "tests.h"
+
+static long double poly_ref(long double x, const double *c, int n) {
+  long double res = 0;
+  for (int k = n - 1; k >= 0; k--) res = res * x + c[k];
+  return res;
+}
+
+START_TEST(poly_1) {
+  double c[16];
+  for (int k = 0; k < 16; k++) c[k] = 1.0 / (k + 1) * (k % 3 ? 1 : -1);
+  for (double x = -1.5; x < 1.5; x += 0.0373) {
+    double x2 = x * x, x4 = x2 * x2, x8 = x4 * x4;
+    ck_assert_double_eq_tol(s21_HORNER3(x, c), poly_ref(x, c, 3), 1e-15);
+    ck_assert_double_eq_tol(s21_HORNER12(x, c), poly_ref(x, c, 12), 1e-13);
+    ck_assert_double_eq_tol(s21_ESTRIN4(x, x2, c), poly_ref(x, c, 4), 1e-14);
+    ck_assert_double_eq_tol(s21_ESTRIN8(x, x2, x4, c), poly_ref(x, c, 8),
+                            1e-13);
+    ck_assert_double_eq_tol(s21_ESTRIN16(x, x2, x4, x8, c),
+                            poly_ref(x, c, 16), 1e-12);
+  }
+}
+END_TEST
+
+START_TEST(poly_2) {
+  double c[s21_POLY_MAX];
+  for (int k = 0; k < s21_POLY_MAX; k++) c[k] = 1.0 / ((k + 2) * (k + 2));
+  for (int n = 0; n <= s21_POLY_MAX; n++) {
+    for (double x = -0.9; x < 0.9; x += 0.17) {
+      long double orig = poly_ref(x, c, n);
+      ck_assert_double_eq_tol(s21_poly_horner(x, c, n), orig, 1e-14);
+      ck_assert_double_eq_tol(s21_poly_estrin(x, c, n), orig, 1e-14);
+    }
+  }
+}
+END_TEST
+
+START_TEST(poly_3) {
+  double c[] = {0.5, -2, 0.25, 1, -0.125};
+  double in[150], out[150];
+  for (int i = 0; i < 150; i++) in[i] = (i - 75) * 0.031;
+  s21_poly_n(c, 5, in, out, 150);
+  for (int i = 0; i < 150; i++) {
+    ck_assert_double_eq_tol(out[i], poly_ref(in[i], c, 5), 1e-14);
+  }
+  s21_poly_n(c, 5, in, in, 150);
+  for (int i = 0; i < 150; i++) ck_assert_double_eq(in[i], out[i]);
+  s21_poly_n(c, 1, in, out, 3);
+  ck_assert_double_eq(out[2], 0.5);
+  s21_poly_n(c, 0, in, out, 3);
+  ck_assert_double_eq(out[1], 0);
+}
+END_TEST
+
+Suite* test_poly(void) {
+  Suite* s25;
+  TCase* tc25;
+  s25 = suite_create("s21_poly");
+  tc25 = tcase_create("case_poly");
+
+  tcase_add_test(tc25, poly_1);
+  tcase_add_test(tc25, poly_2);
+  tcase_add_test(tc25, poly_3);
+
+  suite_add_tcase(s25, tc25);
+  return s25;
+}
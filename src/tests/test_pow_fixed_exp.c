@@ -0,0 +1,122 @@
+#include "tests.h"
+
+static const double pow_fixed_in[] = {0.0,  -0.0,     1.0,       -1.0,
+                                      2.5,  -3.75,    1e-300,    123.456,
+                                      0.01, INFINITY, -INFINITY, NAN};
+
+static void pow_fixed_check(double exp) {
+  double out[12];
+  s21_pow_n_fixed_exp(pow_fixed_in, exp, out, 12);
+  for (int i = 0; i < 12; i++) {
+    double orig = pow(pow_fixed_in[i], exp);
+    if (isnan(orig)) {
+      ck_assert_double_nan(out[i]);
+    } else if (isinf(orig) || orig == 0) {
+      ck_assert_double_eq(out[i], orig);
+      ck_assert_int_eq(!!signbit(out[i]), !!signbit(orig));
+    } else {
+      ck_assert_double_eq_tol(out[i] / orig, 1, 1e-12);
+    }
+  }
+}
+
+START_TEST(pow_fixed_exp_1) { pow_fixed_check(0); }
+END_TEST
+
+START_TEST(pow_fixed_exp_2) { pow_fixed_check(1); }
+END_TEST
+
+START_TEST(pow_fixed_exp_3) { pow_fixed_check(2); }
+END_TEST
+
+START_TEST(pow_fixed_exp_4) { pow_fixed_check(-1); }
+END_TEST
+
+START_TEST(pow_fixed_exp_5) { pow_fixed_check(0.5); }
+END_TEST
+
+START_TEST(pow_fixed_exp_6) { pow_fixed_check(7); }
+END_TEST
+
+START_TEST(pow_fixed_exp_7) { pow_fixed_check(-3); }
+END_TEST
+
+START_TEST(pow_fixed_exp_8) { pow_fixed_check(2.2); }
+END_TEST
+
+START_TEST(pow_fixed_exp_9) { pow_fixed_check(1 / 2.4); }
+END_TEST
+
+START_TEST(pow_fixed_exp_10) { pow_fixed_check(NAN); }
+END_TEST
+
+START_TEST(pow_fixed_exp_11) { pow_fixed_check(-INFINITY); }
+END_TEST
+
+START_TEST(pow_fixed_exp_12) { pow_fixed_check(101); }
+END_TEST
+
+START_TEST(pow_fixed_exp_13) {
+  double buf[] = {1, 4, 9, 16};
+  s21_pow_n_fixed_exp(buf, 0.5, buf, 4);
+  for (int i = 0; i < 4; i++) ck_assert_double_eq(buf[i], i + 1);
+}
+END_TEST
+
+START_TEST(pow_fixed_exp_14) {
+  /* a large exponent magnifies any error in the log of a base near 1 */
+  double buf[100], want[100];
+  for (int i = 0; i < 100; i++) buf[i] = 0.9955 + i * 9.1e-5;
+  for (int i = 0; i < 100; i++) want[i] = pow(buf[i], -123456.789);
+  s21_pow_n_fixed_exp(buf, -123456.789, buf, 100);
+  for (int i = 0; i < 100; i++) {
+    ck_assert_double_eq_tol(buf[i] / want[i], 1, 1e-14);
+  }
+}
+END_TEST
+
+START_TEST(pow_fixed_exp_15) {
+  pow_fixed_check(-8);
+  pow_fixed_check(40);
+  pow_fixed_check(-37);
+}
+END_TEST
+
+START_TEST(pow_fixed_exp_16) {
+  /* x^8 overflows here while x^-8 is still subnormal */
+  double buf[3] = {1e39, -3.5e38, 2e38};
+  double want[3];
+  for (int i = 0; i < 3; i++) want[i] = pow(buf[i], -8);
+  s21_pow_n_fixed_exp(buf, -8, buf, 3);
+  for (int i = 0; i < 3; i++) {
+    ck_assert_double_eq_tol(buf[i] / want[i], 1, 1e-9);
+  }
+}
+END_TEST
+
+Suite* test_pow_fixed_exp(void) {
+  Suite* s17;
+  TCase* tc17;
+  s17 = suite_create("s21_pow_fixed_exp");
+  tc17 = tcase_create("case_pow_fixed_exp");
+
+  tcase_add_test(tc17, pow_fixed_exp_1);
+  tcase_add_test(tc17, pow_fixed_exp_2);
+  tcase_add_test(tc17, pow_fixed_exp_3);
+  tcase_add_test(tc17, pow_fixed_exp_4);
+  tcase_add_test(tc17, pow_fixed_exp_5);
+  tcase_add_test(tc17, pow_fixed_exp_6);
+  tcase_add_test(tc17, pow_fixed_exp_7);
+  tcase_add_test(tc17, pow_fixed_exp_8);
+  tcase_add_test(tc17, pow_fixed_exp_9);
+  tcase_add_test(tc17, pow_fixed_exp_10);
+  tcase_add_test(tc17, pow_fixed_exp_11);
+  tcase_add_test(tc17, pow_fixed_exp_12);
+  tcase_add_test(tc17, pow_fixed_exp_13);
+  tcase_add_test(tc17, pow_fixed_exp_14);
+  tcase_add_test(tc17, pow_fixed_exp_15);
+  tcase_add_test(tc17, pow_fixed_exp_16);
+
+  suite_add_tcase(s17, tc17);
+  return s17;
+}
@@ -0,0 +1,128 @@
+#include "tests.h"
+
+START_TEST(pow_prepare_1) {
+  s21_pow_base h = s21_pow_prepare(456.789);
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, 1.1), pow(456.789, 1.1), 1e-6);
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, -2.5), pow(456.789, -2.5),
+                           1e-6);
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, 3), pow(456.789, 3), 1e-6);
+}
+END_TEST
+
+START_TEST(pow_prepare_2) {
+  s21_pow_base h = s21_pow_prepare(-2.5);
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, 3), pow(-2.5, 3), 1e-6);
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, 101), pow(-2.5, 101), 1e34);
+  ck_assert_ldouble_nan(s21_pow_apply(&h, 0.5));
+}
+END_TEST
+
+START_TEST(pow_prepare_3) {
+  s21_pow_base h = s21_pow_prepare(NAN);
+  ck_assert_ldouble_nan(s21_pow_apply(&h, 2));
+  ck_assert_ldouble_eq(s21_pow_apply(&h, 0), 1);
+}
+END_TEST
+
+START_TEST(pow_prepare_4) {
+  s21_pow_base h = s21_pow_prepare(1);
+  ck_assert_ldouble_eq(s21_pow_apply(&h, NAN), 1);
+  ck_assert_ldouble_eq(s21_pow_apply(&h, INFINITY), 1);
+}
+END_TEST
+
+START_TEST(pow_prepare_5) {
+  s21_pow_base h = s21_pow_prepare(-0.0);
+  ck_assert_ldouble_infinite(s21_pow_apply(&h, -3));
+  ck_assert_int_eq(!!signbit(s21_pow_apply(&h, -3)), !!signbit(pow(-0.0, -3)));
+  ck_assert_int_eq(!!signbit(s21_pow_apply(&h, 3)), !!signbit(pow(-0.0, 3)));
+  ck_assert_ldouble_eq(s21_pow_apply(&h, 2), 0);
+}
+END_TEST
+
+START_TEST(pow_prepare_6) {
+  s21_pow_base h = s21_pow_prepare(-INFINITY);
+  ck_assert_ldouble_infinite(s21_pow_apply(&h, 3));
+  ck_assert_int_eq(!!signbit(s21_pow_apply(&h, 3)),
+                   !!signbit(pow(-INFINITY, 3)));
+  ck_assert_ldouble_eq(s21_pow_apply(&h, -2), 0);
+}
+END_TEST
+
+START_TEST(pow_prepare_7) {
+  s21_pow_base h = s21_pow_prepare(0.5);
+  ck_assert_ldouble_eq(s21_pow_apply(&h, INFINITY), 0);
+  ck_assert_ldouble_infinite(s21_pow_apply(&h, -INFINITY));
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, 1000.5), pow(0.5, 1000.5),
+                           1e-6);
+}
+END_TEST
+
+START_TEST(pow_prepare_8) {
+  s21_pow_base h = s21_pow_prepare(1e-300);
+  ck_assert_ldouble_eq_tol(s21_pow_apply(&h, 0.5) * 1e150, 1, 1e-12);
+  ck_assert_double_infinite((double)s21_pow_apply(&h, -2));
+}
+END_TEST
+
+START_TEST(pow_prepare_9) {
+  double exp[] = {0, 1, -1, 2.2, 1 / 2.4, -7.5, 12, NAN};
+  double out[8];
+  s21_pow_base h = s21_pow_prepare(3.7);
+  s21_pow_apply_n(&h, exp, out, 8);
+  for (int i = 0; i < 7; i++) {
+    ck_assert_double_eq_tol(out[i], pow(3.7, exp[i]), 1e-6);
+  }
+  ck_assert_double_nan(out[7]);
+}
+END_TEST
+
+START_TEST(pow_prepare_10) {
+  /* the batch against the one-shot s21_pow on scattered exponents */
+  double exp[300], out[300];
+  uint64_t state = 12345;
+  for (int i = 0; i < 300; i++) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    exp[i] = (double)(state >> 11) * 0x1.0p-53 * 60 - 30;
+  }
+  s21_pow_base h = s21_pow_prepare(1.7);
+  s21_pow_apply_n(&h, exp, out, 300);
+  for (int i = 0; i < 300; i++) {
+    double want = s21_pow(1.7, exp[i]);
+    ck_assert_double_eq_tol(out[i], want, fabs(want) * 1e-13);
+  }
+  /* a negative base: signed for odd integers, NaN for fractions */
+  for (int i = 0; i < 300; i++) exp[i] = i % 3 ? (i % 41) - 20 : i + 0.5;
+  h = s21_pow_prepare(-2.5);
+  s21_pow_apply_n(&h, exp, exp, 300);
+  for (int i = 0; i < 300; i++) {
+    if (i % 3) {
+      double want = s21_pow(-2.5, (i % 41) - 20);
+      ck_assert_double_eq_tol(exp[i], want, fabs(want) * 1e-14);
+    } else {
+      ck_assert_double_nan(exp[i]);
+    }
+  }
+}
+END_TEST
+
+Suite* test_pow_prepare(void) {
+  Suite* s16;
+  TCase* tc16;
+  s16 = suite_create("s21_pow_prepare");
+  tc16 = tcase_create("case_pow_prepare");
+
+  tcase_add_test(tc16, pow_prepare_1);
+  tcase_add_test(tc16, pow_prepare_2);
+  tcase_add_test(tc16, pow_prepare_3);
+  tcase_add_test(tc16, pow_prepare_4);
+  tcase_add_test(tc16, pow_prepare_5);
+  tcase_add_test(tc16, pow_prepare_6);
+  tcase_add_test(tc16, pow_prepare_7);
+  tcase_add_test(tc16, pow_prepare_8);
+  tcase_add_test(tc16, pow_prepare_9);
+  tcase_add_test(tc16, pow_prepare_10);
+
+  suite_add_tcase(s16, tc16);
+  return s16;
+}
@@ -0,0 +1,59 @@
+#include "tests.h"
+
+START_TEST(powi_1) {
+  for (int n = -20; n <= 20; n++) {
+    ck_assert_ldouble_eq_tol(s21_powi(1.5, n), pow(1.5, n), 1e-6);
+    ck_assert_ldouble_eq_tol(s21_powi(-0.75, n), pow(-0.75, n), 1e-6);
+  }
+}
+END_TEST
+
+START_TEST(powi_2) {
+  ck_assert_ldouble_eq(s21_powi(NAN, 0), 1);
+  ck_assert_ldouble_nan(s21_powi(NAN, 3));
+  ck_assert_ldouble_infinite(s21_powi(0, -1));
+  ck_assert_ldouble_eq(s21_powi(INFINITY, -2), 0);
+}
+END_TEST
+
+START_TEST(powi_3) {
+  double x = 1.0625;
+  ck_assert_ldouble_eq(s21_powi_const(x, 0), 1);
+  ck_assert_ldouble_eq(s21_powi_const(x, 1), x);
+  ck_assert_ldouble_eq_tol(s21_powi_const(x, 3), pow(x, 3), 1e-15);
+  ck_assert_ldouble_eq_tol(s21_powi_const(x, 5), pow(x, 5), 1e-15);
+  ck_assert_ldouble_eq_tol(s21_powi_const(x, 6), pow(x, 6), 1e-15);
+  ck_assert_ldouble_eq_tol(s21_powi_const(x, 7), pow(x, 7), 1e-15);
+  ck_assert_ldouble_eq_tol(s21_powi_const(x, 8), pow(x, 8), 1e-15);
+  ck_assert_ldouble_eq_tol(s21_powi_const(x, -7), pow(x, -7), 1e-15);
+}
+END_TEST
+
+START_TEST(powi_4) {
+  int n = 13;
+  ck_assert_ldouble_eq_tol(s21_powi_const(2.5, n), pow(2.5, 13), 1e-6);
+  ck_assert_ldouble_eq_tol(s21_powi_const(2.5, -9), pow(2.5, -9), 1e-15);
+}
+END_TEST
+
+START_TEST(powi_5) {
+  ck_assert_ldouble_eq_tol(s21_pow(1e-7, 2), pow(1e-7, 2), 1e-20);
+  ck_assert_ldouble_eq_tol(s21_pow(-3, 3), pow(-3, 3), 1e-6);
+}
+END_TEST
+
+Suite* test_powi(void) {
+  Suite* s18;
+  TCase* tc18;
+  s18 = suite_create("s21_powi");
+  tc18 = tcase_create("case_powi");
+
+  tcase_add_test(tc18, powi_1);
+  tcase_add_test(tc18, powi_2);
+  tcase_add_test(tc18, powi_3);
+  tcase_add_test(tc18, powi_4);
+  tcase_add_test(tc18, powi_5);
+
+  suite_add_tcase(s18, tc18);
+  return s18;
+}
@@ -0,0 +1,87 @@
+#include "tests.h"
+
+#define N_SAMPLES 100000
+
+START_TEST(random_1) {
+  /* known answers of the Random123 reference implementation */
+  uint32_t ctr[3][4] = {{0, 0, 0, 0},
+                        {~0u, ~0u, ~0u, ~0u},
+                        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+  uint32_t key[3][2] = {{0, 0}, {~0u, ~0u}, {0xa4093822, 0x299f31d0}};
+  uint32_t want[3][4] = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+                         {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+                         {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+  for (int t = 0; t < 3; t++) {
+    uint32_t out[4];
+    s21_philox4x32(ctr[t], key[t], out);
+    for (int i = 0; i < 4; i++) ck_assert_uint_eq(out[i], want[t][i]);
+  }
+}
+END_TEST
+
+START_TEST(random_2) {
+  static double z[N_SAMPLES];
+  s21_philox_state st;
+  s21_philox_seed(&st, 2024);
+  s21_randn_n(&st, z, N_SAMPLES);
+  ck_assert_uint_eq(st.counter, N_SAMPLES);
+  double sum = 0, sq = 0, below = 0;
+  for (int i = 0; i < N_SAMPLES; i++) {
+    ck_assert(fabs(z[i]) < 9);
+    sum += z[i];
+    sq += z[i] * z[i];
+    below += z[i] < -1.0;
+  }
+  /* about five standard errors */
+  ck_assert_double_eq_tol(sum / N_SAMPLES, 0, 0.016);
+  ck_assert_double_eq_tol(sq / N_SAMPLES, 1, 0.023);
+  ck_assert_double_eq_tol(below / N_SAMPLES, erfc(1 / sqrt(2)) / 2, 0.006);
+}
+END_TEST
+
+START_TEST(random_3) {
+  /* the same stream whole, in odd-sized pieces, and from moved copies
+     as threads would use them */
+  double whole[1000], parts[1000], moved[1000];
+  s21_philox_state st;
+  s21_philox_seed(&st, 7);
+  s21_randn_n(&st, whole, 1000);
+
+  s21_philox_seed(&st, 7);
+  size_t sizes[] = {1, 2, 3, 127, 128, 129, 0, 610};
+  size_t at = 0;
+  for (int i = 0; i < 8; i++) {
+    s21_randn_n(&st, parts + at, sizes[i]);
+    at += sizes[i];
+  }
+  ck_assert_uint_eq(at, 1000);
+  ck_assert_int_eq(memcmp(whole, parts, sizeof(whole)), 0);
+
+  for (size_t t = 0; t < 7; t++) {
+    size_t lo = 1000 * t / 7, hi = 1000 * (t + 1) / 7;
+    s21_philox_state copy;
+    s21_philox_seed(&copy, 7);
+    copy.counter = lo;
+    s21_randn_n(&copy, moved + lo, hi - lo);
+  }
+  ck_assert_int_eq(memcmp(whole, moved, sizeof(whole)), 0);
+
+  s21_philox_seed(&st, 8);
+  s21_randn_n(&st, parts, 1000);
+  ck_assert_int_ne(memcmp(whole, parts, sizeof(whole)), 0);
+}
+END_TEST
+
+Suite* test_random(void) {
+  Suite* s34;
+  TCase* tc34;
+  s34 = suite_create("s21_random");
+  tc34 = tcase_create("case_random");
+
+  tcase_add_test(tc34, random_1);
+  tcase_add_test(tc34, random_2);
+  tcase_add_test(tc34, random_3);
+
+  suite_add_tcase(s34, tc34);
+  return s34;
+}
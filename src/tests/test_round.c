@@ -0,0 +1,131 @@
+#include "tests.h"
+
+/* halfway cases, signed zeros, values around 2^52 and specials */
+static const double special[] = {0.5,
+                                 -0.5,
+                                 1.5,
+                                 -1.5,
+                                 2.5,
+                                 -2.5,
+                                 0.0,
+                                 -0.0,
+                                 0.49999999999999994,
+                                 -0.49999999999999994,
+                                 0x1p52 - 0.5,
+                                 -0x1p52 + 0.5,
+                                 0x1p52 + 1,
+                                 -0x1p52 - 1,
+                                 0x1p53 - 1,
+                                 1e300,
+                                 -1e300,
+                                 0x1p-1074,
+                                 -0x1p-1074,
+                                 INFINITY,
+                                 -INFINITY,
+                                 NAN};
+
+#define N_SPECIAL (int)(sizeof(special) / sizeof(special[0]))
+
+/* results equal as bits, so -0 and +0 differ and NaN matches NaN */
+static void check_same(double got, double want) {
+  ck_assert_int_eq(memcmp(&got, &want, sizeof(got)), 0);
+}
+
+static void fill(double *in, int n) {
+  for (int i = 0; i < n; i++) in[i] = (i - n / 2) * 0.25 + i * 1e-3;
+  for (int i = 0; i < N_SPECIAL && i < n; i++) in[3 * i % n] = special[i];
+}
+
+START_TEST(round_1) {
+  /* 203 elements leave a tail after the vector loop */
+  double in[203], out[203], copy[203];
+  fill(in, 203);
+  void (*batch[4])(const double *, double *, size_t) = {
+      s21_floor_n, s21_ceil_n, s21_trunc_n, s21_round_n};
+  double (*ref[4])(double) = {floor, ceil, trunc, round};
+  for (int f = 0; f < 4; f++) {
+    batch[f](in, out, 203);
+    for (int i = 0; i < 203; i++) check_same(out[i], ref[f](in[i]));
+    memcpy(copy, in, sizeof(in));
+    batch[f](copy, copy, 203);
+    ck_assert_int_eq(memcmp(copy, out, sizeof(out)), 0);
+  }
+}
+END_TEST
+
+START_TEST(round_2) {
+  for (int n = 0; n < 20; n++) {
+    double in[20], out[20];
+    fill(in, 20);
+    out[n < 20 ? n : 0] = 42;
+    s21_round_n(in, out, n);
+    for (int i = 0; i < n; i++) check_same(out[i], round(in[i]));
+    if (n < 20) ck_assert_double_eq(out[n], 42);
+  }
+}
+END_TEST
+
+START_TEST(round_3) {
+  double in[] = {2.5, -2.5, 2.7, -2.7, 1e20, -1e20, NAN, 2147483647.5,
+                 -2147483648.5, -2147483648.0, INFINITY, -INFINITY};
+  int32_t out[12];
+  int32_t want[4][12] = {
+      {2, -3, 2, -3, INT32_MAX, INT32_MIN, 0, INT32_MAX, INT32_MIN,
+       INT32_MIN, INT32_MAX, INT32_MIN},
+      {3, -2, 3, -2, INT32_MAX, INT32_MIN, 0, INT32_MAX, INT32_MIN,
+       INT32_MIN, INT32_MAX, INT32_MIN},
+      {2, -2, 2, -2, INT32_MAX, INT32_MIN, 0, INT32_MAX, INT32_MIN,
+       INT32_MIN, INT32_MAX, INT32_MIN},
+      {3, -3, 3, -3, INT32_MAX, INT32_MIN, 0, INT32_MAX, INT32_MIN,
+       INT32_MIN, INT32_MAX, INT32_MIN}};
+  s21_round_mode modes[4] = {s21_ROUND_FLOOR, s21_ROUND_CEIL,
+                             s21_ROUND_TRUNC, s21_ROUND_NEAREST};
+  for (int m = 0; m < 4; m++) {
+    s21_to_int32_n(in, out, 12, modes[m]);
+    for (int i = 0; i < 12; i++) ck_assert_int_eq(out[i], want[m][i]);
+  }
+}
+END_TEST
+
+START_TEST(round_4) {
+  double in[] = {0x1p63, -0x1p63, 0x1.fffffffffffffp62, 1e300, -1e300,
+                 NAN,    -7.5,    0x1p53 + 2,          -0.5};
+  int64_t out[9];
+  int64_t want[9] = {INT64_MAX,
+                     INT64_MIN,
+                     (int64_t)0x1.fffffffffffffp62,
+                     INT64_MAX,
+                     INT64_MIN,
+                     0,
+                     -8,
+                     (int64_t)0x1p53 + 2,
+                     -1};
+  s21_to_int64_n(in, out, 9, s21_ROUND_NEAREST);
+  for (int i = 0; i < 9; i++) ck_assert_int_eq(out[i], want[i]);
+  s21_to_int64_n(in, out, 9, s21_ROUND_CEIL);
+  ck_assert_int_eq(out[6], -7);
+  ck_assert_int_eq(out[8], 0);
+
+  /* longer than one block */
+  double big[150];
+  int64_t res[150];
+  for (int i = 0; i < 150; i++) big[i] = i * 1.75 - 100;
+  s21_to_int64_n(big, res, 150, s21_ROUND_FLOOR);
+  for (int i = 0; i < 150; i++) ck_assert_int_eq(res[i], floor(big[i]));
+}
+END_TEST
+
+Suite* test_round(void) {
+  Suite* s31;
+  TCase* tc31;
+  s31 = suite_create("s21_round");
+  tc31 = tcase_create("case_round");
+
+  tcase_add_test(tc31, round_1);
+  tcase_add_test(tc31, round_2);
+  tcase_add_test(tc31, round_3);
+  tcase_add_test(tc31, round_4);
+
+  suite_add_tcase(s31, tc31);
+  return s31;
+}
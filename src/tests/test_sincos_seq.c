@@ -0,0 +1,60 @@
+#include "tests.h"
+
+static void check_seq(double x0, double dx, int n, double tol) {
+  double *s = malloc(n * sizeof(double)), *c = malloc(n * sizeof(double));
+  s21_sincos_seq(x0, dx, s, c, n);
+  for (int k = 0; k < n; k++) {
+    /* seeds and x both round x0 + k * dx, so they can differ by an ulp */
+    double x = fma(k, dx, x0), t = tol + fabs(x) * 0x1p-52;
+    ck_assert_double_eq_tol(s[k], sin(x), t);
+    ck_assert_double_eq_tol(c[k], cos(x), t);
+  }
+  free(s);
+  free(c);
+}
+
+START_TEST(sincos_seq_1) {
+  check_seq(0.3, 0.001, 1000, 2e-15);
+  check_seq(-2, s21_PI / 50, 4099, 2e-15);
+  check_seq(1, -0.7, 77, 2e-15);
+  check_seq(5, 0, 130, 2e-15);
+  check_seq(0, 1e-9, 5, 2e-15);
+}
+END_TEST
+
+START_TEST(sincos_seq_2) {
+  check_seq(1e7, 0.5, 300, 2e-15);
+  check_seq(3e6, 1e5, 200, 2e-15);
+  check_seq(0, 1e30, 20, 2e-15);
+}
+END_TEST
+
+START_TEST(sincos_seq_3) {
+  double s[70], c[70];
+  s21_sincos_seq(NAN, 0.1, s, c, 70);
+  for (int k = 0; k < 70; k++) {
+    ck_assert_double_nan(s[k]);
+    ck_assert_double_nan(c[k]);
+  }
+  s21_sincos_seq(0, INFINITY, s, c, 3);
+  ck_assert_double_nan(s[1]);
+  ck_assert_double_nan(c[2]);
+  s[0] = 42;
+  s21_sincos_seq(0, 1, s, c, 0);
+  ck_assert_double_eq(s[0], 42);
+}
+END_TEST
+
+Suite* test_sincos_seq(void) {
+  Suite* s28;
+  TCase* tc28;
+  s28 = suite_create("s21_sincos_seq");
+  tc28 = tcase_create("case_sincos_seq");
+
+  tcase_add_test(tc28, sincos_seq_1);
+  tcase_add_test(tc28, sincos_seq_2);
+  tcase_add_test(tc28, sincos_seq_3);
+
+  suite_add_tcase(s28, tc28);
+  return s28;
+}
@@ -0,0 +1,110 @@
+#include "tests.h"
+
+/* sin and cos of x half turns (or degrees with unit 90), with the
+   quadrant taken off exactly so the reference keeps its precision */
+static void reference(double x, double unit, long double *s,
+                      long double *c) {
+  long double j = rintl(x / unit), r = x - j * unit;
+  long double a = r * (s21_PI / (2 * unit)), sr = sinl(a), cr = cosl(a);
+  long double qs[4] = {sr, cr, -sr, -cr}, qc[4] = {cr, -sr, -cr, sr};
+  *s = qs[(long long)j & 3];
+  *c = qc[(long long)j & 3];
+}
+
+static void check(long double got, long double want) {
+  ck_assert_ldouble_le(fabsl(got - want), fabsl(want) * 0x1.2p-51L);
+}
+
+START_TEST(sinpi_1) {
+  for (double x = -3; x <= 3; x += 0.000731) {
+    long double s, c;
+    reference(x, 0.5, &s, &c);
+    check(s21_sinpi(x), s);
+    check(s21_cospi(x), c);
+    check(s21_tanpi(x), s / c);
+  }
+  ck_assert_ldouble_eq(s21_sinpi(1), 0);
+  ck_assert(!signbit((double)s21_sinpi(3)));
+  ck_assert(signbit((double)s21_sinpi(-2)));
+  ck_assert(signbit((double)s21_sinpi(-0.0)));
+  ck_assert_ldouble_eq(s21_sinpi(0.5), 1);
+  ck_assert_ldouble_eq(s21_sinpi(-2.5), -1);
+  ck_assert_ldouble_eq(s21_cospi(-7), -1);
+  ck_assert(!signbit((double)s21_cospi(-1.5)));
+  ck_assert_ldouble_eq(s21_sinpi(0.25), s21_cospi(0.25));
+  ck_assert_ldouble_eq(s21_tanpi(0.25), 1);
+  ck_assert_ldouble_infinite(s21_tanpi(0.5));
+  ck_assert_ldouble_lt(s21_tanpi(1.5), 0);
+  ck_assert_ldouble_nan(s21_sinpi(INFINITY));
+  ck_assert_ldouble_nan(s21_cospi(NAN));
+  ck_assert_ldouble_nan(s21_tanpi(-INFINITY));
+}
+END_TEST
+
+START_TEST(sinpi_2) {
+  /* beyond 2^50 the reduction works on the integer part */
+  ck_assert_ldouble_eq(s21_cospi(0x1p52 + 1), -1);
+  ck_assert_ldouble_eq(s21_cospi(1e300), 1);
+  ck_assert_ldouble_eq(s21_sinpi(0x1p51 + 0.5), 1);
+  ck_assert_ldouble_eq(s21_sinpi(-0x1p50 - 0.5), -1);
+  ck_assert_ldouble_eq(s21_sinpi(0x1p50 + 0.25), s21_sinpi(0.25));
+  ck_assert_ldouble_eq(s21_cosd(1e22), s21_cosd(280));
+  ck_assert_ldouble_eq(s21_sind(0x1p51 + 0.5), s21_sind(8.5));
+  ck_assert_ldouble_eq(s21_sind(-1e300), -s21_sind(fmod(1e300, 360)));
+}
+END_TEST
+
+START_TEST(sinpi_3) {
+  for (double x = -1000; x <= 1000; x += 0.0731) {
+    long double s, c;
+    reference(x, 90, &s, &c);
+    check(s21_sind(x), s);
+    check(s21_cosd(x), c);
+  }
+  ck_assert_ldouble_eq(s21_sind(30), 0.5);
+  ck_assert_ldouble_eq(s21_cosd(60), 0.5);
+  ck_assert_ldouble_eq(s21_sind(-150), -0.5);
+  ck_assert_ldouble_eq(s21_cosd(-240), -0.5);
+  ck_assert_ldouble_eq(s21_cosd(720), 1);
+  ck_assert_ldouble_eq(s21_sind(45), s21_cosd(45));
+  ck_assert(!signbit((double)s21_cosd(270)));
+  ck_assert(signbit((double)s21_sind(-360)));
+  ck_assert_ldouble_nan(s21_sind(NAN));
+  ck_assert_ldouble_nan(s21_cosd(INFINITY));
+}
+END_TEST
+
+START_TEST(sinpi_4) {
+  double in[200], out[200], want[200];
+  for (int i = 0; i < 200; i++) in[i] = (i - 100) * 0.0173;
+  in[130] = 1e300;
+  in[131] = NAN;
+  void (*batch[5])(const double *, double *, size_t) = {
+      s21_sinpi_n, s21_cospi_n, s21_tanpi_n, s21_sind_n, s21_cosd_n};
+  long double (*scalar[5])(double) = {s21_sinpi, s21_cospi, s21_tanpi,
+                                      s21_sind, s21_cosd};
+  for (int f = 0; f < 5; f++) {
+    for (int i = 0; i < 200; i++) want[i] = scalar[f](in[i]);
+    batch[f](in, out, 200);
+    ck_assert_int_eq(memcmp(out, want, sizeof(out)), 0);
+  }
+  s21_sind_n(in, out, 200);
+  s21_sind_n(in, in, 200);
+  ck_assert_int_eq(memcmp(in, out, sizeof(in)), 0);
+}
+END_TEST
+
+Suite* test_sinpi(void) {
+  Suite* s30;
+  TCase* tc30;
+  s30 = suite_create("s21_sinpi");
+  tc30 = tcase_create("case_sinpi");
+
+  tcase_add_test(tc30, sinpi_1);
+  tcase_add_test(tc30, sinpi_2);
+  tcase_add_test(tc30, sinpi_3);
+  tcase_add_test(tc30, sinpi_4);
+
+  suite_add_tcase(s30, tc30);
+  return s30;
+}
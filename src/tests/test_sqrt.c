@@ -95,6 +95,125 @@ START_TEST(sqrt_16) {
 }
 END_TEST
 
+START_TEST(sqrt_17) {
+  /* the batch form is correctly rounded, so it matches libm exactly */
+  double in[300], out[300];
+  for (int i = 0; i < 300; i++) in[i] = pow(1.37, i - 150) * (1 + i * 1e-3);
+  double special[] = {0.0,     -0.0, INFINITY, -1.0,    NAN,   0x1p-1074,
+                      DBL_MAX, 2.0,  0.25,     DBL_MIN, 1e-300};
+  for (int i = 0; i < 11; i++) in[7 * i] = special[i];
+  s21_sqrt_n(in, out, 300);
+  for (int i = 0; i < 300; i++) {
+    double want = sqrt(in[i]);
+    if (isnan(want)) {
+      ck_assert_double_nan(out[i]);
+    } else {
+      ck_assert_int_eq(memcmp(&out[i], &want, sizeof(want)), 0);
+    }
+  }
+  s21_sqrt_n(in, in, 300);
+  ck_assert_int_eq(memcmp(in + 1, out + 1, 299 * sizeof(double)), 0);
+}
+END_TEST
+
+START_TEST(sqrt_18) {
+  double in[200], out[200];
+  for (int i = 0; i < 200; i++) in[i] = pow(1.9, i - 100) * (1 + i * 1e-3);
+  in[3] = 0x1p-1074;
+  in[4] = DBL_MAX;
+  s21_rsqrt_n(in, out, 200);
+  for (int i = 0; i < 200; i++) {
+    long double want = 1.0L / sqrtl(in[i]);
+    ck_assert_ldouble_le(fabsl(out[i] - want), want * 0x1p-52L);
+  }
+  double special[] = {0.0, -0.0, INFINITY, -2.0, NAN, 4.0};
+  s21_rsqrt_n(special, special, 6);
+  ck_assert_double_eq(special[0], INFINITY);
+  ck_assert_double_eq(special[1], -INFINITY);
+  ck_assert_double_eq(special[2], 0.0);
+  ck_assert_double_nan(special[3]);
+  ck_assert_double_nan(special[4]);
+  ck_assert_double_eq(special[5], 0.5);
+}
+END_TEST
+
+static void check_unit(const double *v, const double *o) {
+  long double len = sqrtl((long double)v[0] * v[0] +
+                          (long double)v[1] * v[1] + (long double)v[2] * v[2]);
+  for (int k = 0; k < 3; k++) {
+    ck_assert_ldouble_le(fabsl(o[k] - v[k] / len), 0x1p-51L);
+  }
+}
+
+START_TEST(sqrt_19) {
+  /* 70 vectors, more than one block */
+  double aos[210], soa[210], out[210];
+  for (int i = 0; i < 70; i++) {
+    double scale = pow(2.0, (i % 7) * 250 - 750);
+    for (int k = 0; k < 3; k++) {
+      aos[3 * i + k] = scale * sin(i * 0.7 + k * 2.1);
+      soa[k * 70 + i] = aos[3 * i + k];
+    }
+  }
+  s21_normalize3_n(aos, out, 70, s21_LAYOUT_AOS);
+  for (int i = 0; i < 70; i++) check_unit(aos + 3 * i, out + 3 * i);
+  s21_normalize3_n(soa, soa, 70, s21_LAYOUT_SOA);
+  for (int i = 0; i < 70; i++) {
+    for (int k = 0; k < 3; k++) {
+      ck_assert_double_eq(soa[k * 70 + i], out[3 * i + k]);
+    }
+  }
+
+  double v[12] = {0, -0.0, 0, 3, 0, 4, INFINITY, 1, 1, NAN, 0, 0};
+  s21_normalize3_n(v, v, 4, s21_LAYOUT_AOS);
+  ck_assert_double_eq(v[0], 0);
+  ck_assert(signbit(v[1]));
+  ck_assert_double_eq_tol(v[3], 0.6, 2e-16);
+  ck_assert_double_eq_tol(v[5], 0.8, 2e-16);
+  for (int k = 6; k < 12; k++) ck_assert_double_nan(v[k]);
+}
+END_TEST
+
+START_TEST(sqrt_20) {
+  /* squares and their neighbours, where a truncated double root fails */
+  uint64_t roots[] = {0, 1, 2, 3, 94906265, 94906266, 0xffffffff,
+                      0x7fffffff, 3037000499ULL, 4294967294ULL};
+  for (int i = 0; i < 10; i++) {
+    uint64_t r = roots[i], sq = r * r;
+    ck_assert_uint_eq(s21_isqrt_u64(sq), r);
+    if (r) ck_assert_uint_eq(s21_isqrt_u64(sq - 1), r - 1);
+    if (r < 0xffffffff) ck_assert_uint_eq(s21_isqrt_u64(sq + 2 * r), r);
+  }
+  ck_assert_uint_eq(s21_isqrt_u64(UINT64_MAX), 0xffffffff);
+  ck_assert_uint_eq(s21_isqrt_u32(UINT32_MAX), 65535);
+  ck_assert_uint_eq(s21_isqrt_u32(65536u * 65535u), 65535);
+  ck_assert_uint_eq(s21_isqrt_u32(65535u * 65535u - 1), 65534);
+  ck_assert_uint_eq(s21_isqrt_u32(0), 0);
+}
+END_TEST
+
+START_TEST(sqrt_21) {
+  uint64_t in64[100], out64[100];
+  uint32_t in32[100], out32[100];
+  for (int i = 0; i < 100; i++) {
+    in64[i] = 0x9e3779b97f4a7c15ULL >> (i % 64);
+    in32[i] = (uint32_t)(in64[i] >> 32) + (uint32_t)i;
+  }
+  s21_isqrt_u64_n(in64, out64, 100);
+  s21_isqrt_u32_n(in32, in32, 100);
+  for (int i = 0; i < 100; i++) {
+    uint64_t r = out64[i];
+    ck_assert(r * r <= in64[i]);
+    ck_assert(r == 0xffffffff || (r + 1) * (r + 1) > in64[i]);
+    uint32_t n32 = (uint32_t)(in64[i] >> 32) + (uint32_t)i;
+    out32[i] = s21_isqrt_u32(n32);
+    ck_assert_uint_eq(in32[i], out32[i]);
+    ck_assert((uint64_t)out32[i] * out32[i] <= n32);
+    ck_assert((uint64_t)(out32[i] + 1) * (out32[i] + 1) > n32);
+  }
+}
+END_TEST
+
 Suite* test_sqrt(void) {
   Suite* s14;
   TCase* tc14;
@@ -116,6 +235,11 @@ Suite* test_sqrt(void) {
   tcase_add_test(tc14, sqrt_14);
   tcase_add_test(tc14, sqrt_15);
   tcase_add_test(tc14, sqrt_16);
+  tcase_add_test(tc14, sqrt_17);
+  tcase_add_test(tc14, sqrt_18);
+  tcase_add_test(tc14, sqrt_19);
+  tcase_add_test(tc14, sqrt_20);
+  tcase_add_test(tc14, sqrt_21);
 
   suite_add_tcase(s14, tc14);
   return s14;
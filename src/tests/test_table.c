@@ -0,0 +1,71 @@
+#include "tests.h"
+
+static long double sine(double x) { return sinl(x); }
+
+static long double expo(double x) { return expl(x); }
+
+START_TEST(table_1) {
+  s21_table *tb = s21_table_build(sine, 0, 2 * s21_PI, 4096, s21_TABLE_LINEAR);
+  ck_assert_ptr_nonnull(tb);
+  ck_assert_int_eq((size_t)tb->val % 64, 0);
+  ck_assert_double_le(tb->err, 4e-7);
+  for (double x = 0; x < 2 * s21_PI; x += 0.000917) {
+    ck_assert_ldouble_eq_tol(s21_table_eval(tb, x), sin(x), tb->err * 1.01);
+  }
+  ck_assert_ldouble_eq_tol(s21_table_eval(tb, 2 * s21_PI), 0, 1e-15);
+  ck_assert_ldouble_nan(s21_table_eval(tb, -0.001));
+  ck_assert_ldouble_nan(s21_table_eval(tb, 7));
+  ck_assert_ldouble_nan(s21_table_eval(tb, NAN));
+  s21_table_free(tb);
+}
+END_TEST
+
+START_TEST(table_2) {
+  s21_table *tb = s21_table_build(expo, -1, 1, 1000, s21_TABLE_CUBIC);
+  ck_assert_ptr_nonnull(tb);
+  ck_assert_int_eq((size_t)tb->val % 64, 0);
+  ck_assert_double_le(tb->err, 2e-9);
+  double in[301], out[301];
+  for (int i = 0; i < 301; i++) in[i] = -1.1 + i / 136.0;
+  s21_table_eval_n(tb, in, out, 301);
+  for (int i = 0; i < 301; i++) {
+    if (in[i] < -1 || in[i] > 1) {
+      ck_assert_double_nan(out[i]);
+    } else {
+      ck_assert_double_eq_tol(out[i], exp(in[i]), tb->err * 1.01);
+      ck_assert_double_eq(out[i], s21_table_eval(tb, in[i]));
+    }
+  }
+  s21_table_eval_n(tb, in, in, 301);
+  for (int i = 14; i < 286; i++) ck_assert_double_eq(in[i], out[i]);
+  s21_table_free(tb);
+}
+END_TEST
+
+START_TEST(table_3) {
+  s21_table *tb = s21_table_build(expo, 0, 1, 2, s21_TABLE_LINEAR);
+  ck_assert_ptr_nonnull(tb);
+  ck_assert_ldouble_eq_tol(s21_table_eval(tb, 0.5), (1 + s21_EXP) / 2, 1e-15);
+  s21_table_free(tb);
+  ck_assert_ptr_null(s21_table_build(expo, 0, 1, 2, s21_TABLE_CUBIC));
+  ck_assert_ptr_null(s21_table_build(expo, 1, 1, 16, s21_TABLE_LINEAR));
+  ck_assert_ptr_null(s21_table_build(expo, 0, INFINITY, 16, s21_TABLE_CUBIC));
+  ck_assert_ptr_null(s21_table_build(NULL, 0, 1, 16, s21_TABLE_LINEAR));
+  ck_assert_ptr_null(s21_table_build(expo, 0, 1, 16, (s21_table_interp)7));
+  s21_table_free(NULL);
+}
+END_TEST
+
+Suite* test_table(void) {
+  Suite* s27;
+  TCase* tc27;
+  s27 = suite_create("s21_table");
+  tc27 = tcase_create("case_table");
+
+  tcase_add_test(tc27, table_1);
+  tcase_add_test(tc27, table_2);
+  tcase_add_test(tc27, table_3);
+
+  suite_add_tcase(s27, tc27);
+  return s27;
+}
@@ -0,0 +1,107 @@
+#include "tests.h"
+
+/* reference with the quadrant taken off in integers, as 2 pi k / n itself
+   is not accurate enough near the zeros */
+static void reference(size_t k, size_t n, long double *c, long double *s) {
+  long long m = 4 * (long long)k, q = (m + (long long)n / 2) / (long long)n;
+  m -= q * (long long)n;
+  long double r = s21_PI / 2 * ((long double)m / n), cr = cosl(r),
+              sr = sinl(r);
+  long double qc[4] = {cr, -sr, -cr, sr}, qs[4] = {sr, cr, -sr, -cr};
+  *c = qc[q & 3];
+  *s = qs[q & 3];
+}
+
+static void check_table(size_t n) {
+  const s21_twiddles *tw = s21_twiddles_get(n);
+  ck_assert_ptr_nonnull(tw);
+  ck_assert_uint_eq(tw->n, n);
+  ck_assert_uint_eq((uintptr_t)tw->re % 64, 0);
+  ck_assert_uint_eq((uintptr_t)tw->im % 64, 0);
+  for (size_t k = 0; k < n; k++) {
+    long double c, s;
+    reference(k, n, &c, &s);
+    ck_assert_ldouble_le(fabsl(tw->re[k] - c), fabsl(c) * 0x1.4p-52L);
+    ck_assert_ldouble_le(fabsl(tw->im[k] - s), fabsl(s) * 0x1.4p-52L);
+  }
+}
+
+START_TEST(twiddles_1) {
+  size_t ns[] = {1, 2, 3, 5, 8, 12, 60, 1000, 1024, 4096, 48000, 65536};
+  for (int i = 0; i < 12; i++) check_table(ns[i]);
+  const s21_twiddles *tw = s21_twiddles_get(16);
+  ck_assert_double_eq(tw->re[0], 1);
+  ck_assert_double_eq(tw->im[4], 1);
+  ck_assert_double_eq(tw->re[8], -1);
+  ck_assert_double_eq(tw->im[12], -1);
+  ck_assert(!signbit(tw->re[4]) && !signbit(tw->im[8]));
+  ck_assert_double_eq(tw->re[2], tw->im[2]);
+}
+END_TEST
+
+START_TEST(twiddles_2) {
+  const s21_twiddles *a = s21_twiddles_get(360);
+  ck_assert_ptr_eq(s21_twiddles_get(360), a);
+  ck_assert_ptr_eq(s21_twiddles_map(360, NULL), a);
+  ck_assert_ptr_null(s21_twiddles_get(0));
+  ck_assert_ptr_null(s21_twiddles_map(0, "twiddles_0.tmp"));
+}
+END_TEST
+
+START_TEST(twiddles_3) {
+  const char *path = "twiddles_test.tmp";
+  remove(path);
+  const s21_twiddles *tw = s21_twiddles_map(768, path);
+  ck_assert_ptr_nonnull(tw);
+  ck_assert_ptr_eq(s21_twiddles_map(768, path), tw);
+  ck_assert_ptr_eq(s21_twiddles_get(768), tw);
+  FILE *f = fopen(path, "rb");
+  ck_assert_ptr_nonnull(f);
+  double head[8], re[768], im[768];
+  ck_assert_uint_eq(fread(head, sizeof(double), 8, f), 8);
+  ck_assert_uint_eq(fread(re, sizeof(double), 768, f), 768);
+  ck_assert_uint_eq(fread(im, sizeof(double), 768, f), 768);
+  fclose(f);
+  ck_assert_int_eq(memcmp(re, tw->re, sizeof(re)), 0);
+  ck_assert_int_eq(memcmp(im, tw->im, sizeof(im)), 0);
+  /* a file for another n is not picked up */
+  const s21_twiddles *other = s21_twiddles_map(100, path);
+  ck_assert_ptr_nonnull(other);
+  ck_assert_uint_eq(other->n, 100);
+  ck_assert_double_eq(other->re[25] + 1, 1);
+  ck_assert_ptr_nonnull(s21_twiddles_map(99, "no/such/dir/twiddles.tmp"));
+  remove(path);
+}
+END_TEST
+
+START_TEST(twiddles_4) {
+  /* a table cached by get is still written out by map */
+  const char *path = "twiddles_test4.tmp";
+  remove(path);
+  const s21_twiddles *tw = s21_twiddles_get(320);
+  ck_assert_ptr_eq(s21_twiddles_map(320, path), tw);
+  FILE *f = fopen(path, "rb");
+  ck_assert_ptr_nonnull(f);
+  double head[8], re[320];
+  ck_assert_uint_eq(fread(head, sizeof(double), 8, f), 8);
+  ck_assert_uint_eq(fread(re, sizeof(double), 320, f), 320);
+  fclose(f);
+  ck_assert_int_eq(memcmp(re, tw->re, sizeof(re)), 0);
+  remove(path);
+}
+END_TEST
+
+Suite* test_twiddles(void) {
+  Suite* s29;
+  TCase* tc29;
+  s29 = suite_create("s21_twiddles");
+  tc29 = tcase_create("case_twiddles");
+
+  tcase_add_test(tc29, twiddles_1);
+  tcase_add_test(tc29, twiddles_2);
+  tcase_add_test(tc29, twiddles_3);
+  tcase_add_test(tc29, twiddles_4);
+
+  suite_add_tcase(s29, tc29);
+  return s29;
+}
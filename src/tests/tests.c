@@ -6,7 +6,12 @@ int main(void) {
       test_abs(),   test_asin(), test_acos(), test_atan(),
       test_ceil(),  test_cos(),  test_exp(),  test_fabs(),
       test_floor(), test_fmod(), test_log(),  test_pow(),
-      test_sin(),   test_sqrt(), test_tan(),  NULL};
+      test_sin(),   test_sqrt(), test_tan(),  test_pow_prepare(),
+      test_pow_fixed_exp(), test_powi(), test_exp_family(), test_log_family(),
+      test_atan2_hypot(), test_polar(), test_hyperbolic(), test_activation(),
+      test_poly(), test_cheb(), test_table(), test_sincos_seq(),
+      test_twiddles(), test_sinpi(), test_round(), test_gamma(), test_erf(),
+      test_random(), NULL};
 
   for (int i = 0; s21_string_test[i] != NULL; i++) {  // (&& failed == 0)
     SRunner* sr = srunner_create(s21_string_test[i]);
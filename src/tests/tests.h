@@ -28,5 +28,24 @@ Suite* test_pow(void);
 Suite* test_sin(void);
 Suite* test_sqrt(void);
 Suite* test_tan(void);
+Suite* test_pow_prepare(void);
+Suite* test_pow_fixed_exp(void);
+Suite* test_powi(void);
+Suite* test_exp_family(void);
+Suite* test_log_family(void);
+Suite* test_atan2_hypot(void);
+Suite* test_polar(void);
+Suite* test_hyperbolic(void);
+Suite* test_activation(void);
+Suite* test_poly(void);
+Suite* test_cheb(void);
+Suite* test_table(void);
+Suite* test_sincos_seq(void);
+Suite* test_twiddles(void);
+Suite* test_sinpi(void);
+Suite* test_round(void);
+Suite* test_gamma(void);
+Suite* test_erf(void);
+Suite* test_random(void);
 
 #endif  // SRC_TESTS_H
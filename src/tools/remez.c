@@ -0,0 +1,348 @@
+/*
+ * remez - minimax polynomial coefficients for the s21_math kernels.
+ *
+ * Usage: remez FUNC LO HI DEGREE [options]
+ *   --rel           minimize the relative instead of the absolute error
+ *   --odd, --even   use only the odd or only the even powers up to DEGREE
+ *   --target EPS    take the lowest degree up to DEGREE whose error, with
+ *                   the coefficients rounded to double, is at most EPS
+ *   --center C      expand in powers of x - C instead of x
+ *   --cheb          interpolate at Chebyshev nodes instead of running the
+ *                   exchange; close to minimax for smooth functions on
+ *                   short intervals, where the exchange can stall once
+ *                   the error nears the rounding of the coefficients
+ *   --name NAME     name of the emitted array, s21_FUNC_coef by default
+ *   --out FILE      write the header to FILE instead of stdout
+ *
+ * The exchange runs in long double. The header lists the coefficients
+ * lowest power first, the order s21_poly.h expects, together with the
+ * error bound measured after rounding them to double.
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_TERMS 32
+#define MAX_ITER 100
+#define SAMPLES 64
+#define GRID 20000
+
+typedef long double (*func_t)(long double);
+
+/* scaled complementary error function erfc(x) e^(x^2), finite for x > 0 */
+static long double erfcxl(long double x) { return erfcl(x) * expl(x * x); }
+
+static const struct {
+    const char *name;
+    func_t f;
+} funcs[] = {
+    {"exp", expl},   {"expm1", expm1l}, {"exp2", exp2l}, {"log", logl},
+    {"log1p", log1pl}, {"log2", log2l}, {"sin", sinl},   {"cos", cosl},
+    {"tan", tanl},   {"atan", atanl},   {"asin", asinl}, {"acos", acosl},
+    {"sinh", sinhl}, {"cosh", coshl},   {"tanh", tanhl}, {"erf", erfl},
+    {"erfc", erfcl}, {"lgamma", lgammal}, {"sqrt", sqrtl}, {"cbrt", cbrtl},
+    {"erfcx", erfcxl},
+};
+
+typedef struct {
+    func_t f;
+    long double lo, hi, center;
+    int rel, cheb;
+    int terms;
+    int powers[MAX_TERMS];
+} problem;
+
+static long double eval(const problem *p, const long double *c,
+                        long double x) {
+    long double res = 0;
+    for (int k = p->terms - 1; k >= 0; k--) {
+        res += c[k] * powl(x - p->center, p->powers[k]);
+    }
+    return res;
+}
+
+/* weighted error; points where a relative error is undefined count as 0 */
+static long double error(const problem *p, const long double *c,
+                         long double x) {
+    long double fx = p->f(x), e = eval(p, c, x) - fx;
+    if (!p->rel) return e;
+    return fx != 0 ? e / fabsl(fx) : 0;
+}
+
+/* Gaussian elimination with partial pivoting, a is n x (n + 1) */
+static int solve(long double a[][MAX_TERMS + 2], int n, long double *x) {
+    for (int col = 0; col < n; col++) {
+        int piv = col;
+        for (int r = col + 1; r < n; r++) {
+            if (fabsl(a[r][col]) > fabsl(a[piv][col])) piv = r;
+        }
+        if (a[piv][col] == 0) return -1;
+        for (int k = 0; k <= n; k++) {
+            long double t = a[col][k];
+            a[col][k] = a[piv][k];
+            a[piv][k] = t;
+        }
+        for (int r = col + 1; r < n; r++) {
+            long double m = a[r][col] / a[col][col];
+            for (int k = col; k <= n; k++) a[r][k] -= m * a[col][k];
+        }
+    }
+    for (int r = n - 1; r >= 0; r--) {
+        long double s = a[r][n];
+        for (int k = r + 1; k < n; k++) s -= a[r][k] * x[k];
+        x[r] = s / a[r][r];
+    }
+    return 0;
+}
+
+/*
+ * Coefficients that make the error equioscillate on the reference. The
+ * system is set up in x / scale, which lies in [-1, 1], so the columns
+ * of high powers are not many orders of magnitude below the others.
+ */
+static int level(const problem *p, const long double *ref, long double *c) {
+    static long double a[MAX_TERMS + 1][MAX_TERMS + 2];
+    long double sol[MAX_TERMS + 1];
+    long double scale =
+        fmaxl(fabsl(p->lo - p->center), fabsl(p->hi - p->center));
+    int n = p->terms + 1;
+    for (int i = 0; i < n; i++) {
+        long double fx = p->f(ref[i]);
+        for (int k = 0; k < p->terms; k++) {
+            a[i][k] = powl((ref[i] - p->center) / scale, p->powers[k]);
+        }
+        a[i][p->terms] = (i % 2 ? -1 : 1) * (p->rel ? fabsl(fx) : 1);
+        a[i][n] = fx;
+    }
+    if (solve(a, n, sol)) return -1;
+    for (int k = 0; k < p->terms; k++) {
+        c[k] = sol[k] / powl(scale, p->powers[k]);
+        if (!isfinite(c[k])) return -1;
+    }
+    return 0;
+}
+
+static long double find_zero(const problem *p, const long double *c,
+                             long double a, long double b) {
+    long double ea = error(p, c, a);
+    for (int it = 0; it < 100 && a < b; it++) {
+        long double m = a + (b - a) / 2, em = error(p, c, m);
+        if (m <= a || m >= b) break;
+        if ((em < 0) == (ea < 0)) {
+            a = m;
+            ea = em;
+        } else {
+            b = m;
+        }
+    }
+    return a + (b - a) / 2;
+}
+
+/* point of largest |error| in [a, b]: coarse scan, then golden section */
+static long double find_extremum(const problem *p, const long double *c,
+                                 long double a, long double b) {
+    long double step = (b - a) / SAMPLES, best = a;
+    for (int i = 0; i <= SAMPLES; i++) {
+        long double x = i == SAMPLES ? b : a + i * step;
+        if (fabsl(error(p, c, x)) > fabsl(error(p, c, best))) best = x;
+    }
+    long double lo = fmaxl(a, best - step), hi = fminl(b, best + step);
+    const long double g = 0.61803398874989484820L;
+    for (int it = 0; it < 120 && hi > lo; it++) {
+        long double x1 = hi - g * (hi - lo), x2 = lo + g * (hi - lo);
+        if (fabsl(error(p, c, x1)) > fabsl(error(p, c, x2))) {
+            hi = x2;
+        } else {
+            lo = x1;
+        }
+    }
+    long double mid = lo + (hi - lo) / 2;
+    return fabsl(error(p, c, mid)) > fabsl(error(p, c, best)) ? mid : best;
+}
+
+/* runs the exchange; returns the levelled error or a negative value */
+static long double remez(const problem *p, long double *c) {
+    long double ref[MAX_TERMS + 1], bounds[MAX_TERMS + 2];
+    int n = p->terms + 1;
+    long double mid = (p->lo + p->hi) / 2, half = (p->hi - p->lo) / 2;
+    for (int i = 0; i < n; i++) {
+        ref[i] = mid - half * cosl(3.14159265358979323846L * (2 * i + 1) /
+                                   (2 * n));
+    }
+    long double lev = -1;
+    for (int it = 0; it < MAX_ITER; it++) {
+        if (level(p, ref, c)) return -1;
+        bounds[0] = p->lo;
+        bounds[n] = p->hi;
+        for (int i = 1; i < n; i++) {
+            bounds[i] = find_zero(p, c, ref[i - 1], ref[i]);
+        }
+        long double emax = 0, emin = INFINITY;
+        for (int i = 0; i < n; i++) {
+            ref[i] = find_extremum(p, c, bounds[i], bounds[i + 1]);
+            long double e = fabsl(error(p, c, ref[i]));
+            emax = fmaxl(emax, e);
+            emin = fminl(emin, e);
+        }
+        lev = emax;
+        if (emax - emin <= 1e-6L * emax) break;
+    }
+    return lev;
+}
+
+/* polynomial through f at the Chebyshev nodes; returns its max error */
+static long double interpolate(const problem *p, long double *c) {
+    static long double a[MAX_TERMS + 1][MAX_TERMS + 2];
+    long double sol[MAX_TERMS + 1];
+    long double scale =
+        fmaxl(fabsl(p->lo - p->center), fabsl(p->hi - p->center));
+    long double mid = (p->lo + p->hi) / 2, half = (p->hi - p->lo) / 2;
+    int n = p->terms;
+    for (int i = 0; i < n; i++) {
+        long double x = mid - half * cosl(3.14159265358979323846L *
+                                          (2 * i + 1) / (2 * n));
+        for (int k = 0; k < n; k++) {
+            a[i][k] = powl((x - p->center) / scale, p->powers[k]);
+        }
+        a[i][n] = p->f(x);
+    }
+    if (solve(a, n, sol)) return -1;
+    long double res = 0;
+    for (int k = 0; k < n; k++) c[k] = sol[k] / powl(scale, p->powers[k]);
+    for (int i = 0; i <= GRID; i++) {
+        long double x = p->lo + (p->hi - p->lo) * i / GRID;
+        res = fmaxl(res, fabsl(error(p, c, x)));
+    }
+    return res;
+}
+
+/* max |error| over a dense grid with the coefficients rounded to double */
+static long double measure(const problem *p, const long double *c) {
+    long double cd[MAX_TERMS], res = 0;
+    for (int k = 0; k < p->terms; k++) cd[k] = (double)c[k];
+    for (int i = 0; i <= GRID; i++) {
+        long double x = p->lo + (p->hi - p->lo) * i / GRID;
+        res = fmaxl(res, fabsl(error(p, cd, x)));
+    }
+    return res;
+}
+
+static void set_powers(problem *p, int degree, int parity) {
+    p->terms = 0;
+    for (int k = 0; k <= degree && p->terms < MAX_TERMS; k++) {
+        if (parity < 0 || k % 2 == parity) p->powers[p->terms++] = k;
+    }
+}
+
+static void emit(FILE *out, const problem *p, const long double *c,
+                 long double err, const char *name, int argc, char **argv) {
+    char upper[128];
+    size_t len = strlen(name);
+    for (size_t i = 0; i <= len; i++) {
+        upper[i] = (char)toupper((unsigned char)name[i]);
+    }
+    int first = p->powers[0], last = p->powers[p->terms - 1];
+
+    fprintf(out, "/* Generated by:");
+    for (int i = 0; i < argc; i++) fprintf(out, " %s", argv[i]);
+    fprintf(out, "\n * Minimax fit on [%.17Lg, %.17Lg],\n", p->lo, p->hi);
+    const char *var = p->center != 0 ? "x - center" : "x";
+    if (p->terms > 3) {
+        fprintf(out, " * powers %d, %d, ..., %d of %s.\n", first,
+                p->powers[1], last, var);
+    } else {
+        fprintf(out, " * powers %d to %d of %s.\n", first, last, var);
+    }
+    fprintf(out, " * Max %s error with these coefficients: %.3Le */\n",
+            p->rel ? "relative" : "absolute", err);
+    fprintf(out, "#ifndef %s_H_\n#define %s_H_\n\n", upper, upper);
+    fprintf(out, "#define %s_N %d\n", upper, p->terms);
+    fprintf(out, "#define %s_ERROR %.3Le\n\n", upper, err);
+    fprintf(out, "static const double %s[%d] = {\n", name, p->terms);
+    for (int k = 0; k < p->terms; k++) {
+        fprintf(out, "    %a, /* x^%d */\n", (double)c[k], p->powers[k]);
+    }
+    fprintf(out, "};\n\n#endif  // %s_H_\n", upper);
+}
+
+static int usage(void) {
+    fprintf(stderr,
+            "usage: remez FUNC LO HI DEGREE [--rel] [--odd | --even]\n"
+            "             [--target EPS] [--center C] [--cheb]\n"
+            "             [--name NAME] [--out FILE]\n"
+            "functions:");
+    for (size_t i = 0; i < sizeof(funcs) / sizeof(funcs[0]); i++) {
+        fprintf(stderr, " %s", funcs[i].name);
+    }
+    fprintf(stderr, "\n");
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 5) return usage();
+    problem p = {0};
+    for (size_t i = 0; i < sizeof(funcs) / sizeof(funcs[0]); i++) {
+        if (!strcmp(argv[1], funcs[i].name)) p.f = funcs[i].f;
+    }
+    if (!p.f) return usage();
+    p.lo = strtold(argv[2], NULL);
+    p.hi = strtold(argv[3], NULL);
+    int degree = atoi(argv[4]), parity = -1;
+    long double target = 0;
+    char name[120];
+    snprintf(name, sizeof(name), "s21_%s_coef", argv[1]);
+    const char *path = NULL;
+    for (int i = 5; i < argc; i++) {
+        if (!strcmp(argv[i], "--rel")) {
+            p.rel = 1;
+        } else if (!strcmp(argv[i], "--odd")) {
+            parity = 1;
+        } else if (!strcmp(argv[i], "--even")) {
+            parity = 0;
+        } else if (!strcmp(argv[i], "--target") && i + 1 < argc) {
+            target = strtold(argv[++i], NULL);
+        } else if (!strcmp(argv[i], "--cheb")) {
+            p.cheb = 1;
+        } else if (!strcmp(argv[i], "--center") && i + 1 < argc) {
+            p.center = strtold(argv[++i], NULL);
+        } else if (!strcmp(argv[i], "--name") && i + 1 < argc) {
+            snprintf(name, sizeof(name), "%s", argv[++i]);
+        } else if (!strcmp(argv[i], "--out") && i + 1 < argc) {
+            path = argv[++i];
+        } else {
+            return usage();
+        }
+    }
+    if (!(p.lo < p.hi) || degree < 0 || degree >= MAX_TERMS * 2) {
+        return usage();
+    }
+
+    long double c[MAX_TERMS], err = -1;
+    for (int d = target > 0 ? 0 : degree; d <= degree; d++) {
+        set_powers(&p, d, parity);
+        if (p.terms == 0 || (d > 0 && p.powers[p.terms - 1] != d)) continue;
+        if ((p.cheb ? interpolate(&p, c) : remez(&p, c)) < 0) {
+            fprintf(stderr, "remez: singular system at degree %d\n", d);
+            return 1;
+        }
+        err = measure(&p, c);
+        if (err <= target) break;
+    }
+    if (err < 0) return usage();
+    if (target > 0 && err > target) {
+        fprintf(stderr, "remez: degree %d only reaches %.3Le\n", degree, err);
+        return 1;
+    }
+
+    FILE *out = path ? fopen(path, "w") : stdout;
+    if (!out) {
+        perror(path);
+        return 1;
+    }
+    emit(out, &p, c, err, name, argc, argv);
+    if (path) fclose(out);
+    return 0;
+}